@@ -1,278 +1,431 @@
 #include "fileManager.h"
 
-// Dynamic Array Implementation
+// Dynamic Array Implementation (segmented)
+
+// Records are relocated by move (append, move assignment); that must never throw
+static_assert(is_nothrow_move_constructible<Transaction>::value && is_nothrow_move_assignable<Transaction>::value,
+              "Transaction moves must be noexcept");
+
 DynamicArray::DynamicArray() {
-    capacity = 1000;
+    segments = nullptr;
+    segmentCount = 0;
+    directoryCapacity = 0;
     size = 0;
-    arr = new Transaction[capacity];
 }
 
 DynamicArray::~DynamicArray() {
-    delete[] arr;
+    destroyRecords();
+    for (size_t i = 0; i < segmentCount; i++) {
+        ::operator delete(segments[i]);
+    }
+    delete[] segments;
+}
+
+DynamicArray::DynamicArray(DynamicArray&& other) noexcept {
+    segments = other.segments;
+    segmentCount = other.segmentCount;
+    directoryCapacity = other.directoryCapacity;
+    size = other.size;
+
+    other.segments = nullptr;
+    other.segmentCount = 0;
+    other.directoryCapacity = 0;
+    other.size = 0;
 }
 
-// Optimized resize function
-void DynamicArray::resize() {
-    int newCapacity = capacity + (capacity / 2); // Grow by 50% instead of doubling
-    if (newCapacity > 200000) {
-        newCapacity = capacity + 5000; // Linear growth for large arrays
+DynamicArray& DynamicArray::operator=(DynamicArray&& other) noexcept {
+    if (this != &other) {
+        destroyRecords();
+        for (size_t i = 0; i < segmentCount; i++) {
+            ::operator delete(segments[i]);
+        }
+        delete[] segments;
+
+        segments = other.segments;
+        segmentCount = other.segmentCount;
+        directoryCapacity = other.directoryCapacity;
+        size = other.size;
+
+        other.segments = nullptr;
+        other.segmentCount = 0;
+        other.directoryCapacity = 0;
+        other.size = 0;
     }
+    return *this;
+}
 
-    Transaction* newArr = new Transaction[newCapacity];
+// Adds one segment; only the pointer directory is ever copied (it grows geometrically)
+void DynamicArray::addSegment() {
+    if (segmentCount == directoryCapacity) {
+        size_t newCapacity = (directoryCapacity == 0) ? 16 : directoryCapacity * 2;
+        Transaction** newSegments = new Transaction*[newCapacity];
+        for (size_t i = 0; i < segmentCount; i++) {
+            newSegments[i] = segments[i];
+        }
+        delete[] segments;
+        segments = newSegments;
+        directoryCapacity = newCapacity;
+    }
+    // Raw storage: records are constructed in place as they arrive, not up front
+    segments[segmentCount++] = static_cast<Transaction*>(::operator new(sizeof(Transaction) * TRANSACTION_SEGMENT_SIZE));
+}
 
-    // Fast memory copy
-    for (int i = 0; i < size; i++) {
-        newArr[i] = arr[i];
+void DynamicArray::destroyRecords() {
+    for (size_t i = 0; i < size; i++) {
+        (*this)[i].~Transaction();
     }
+    size = 0;
+}
 
-    delete[] arr;
-    arr = newArr;
-    capacity = newCapacity;
+// Storage for the slot after the last record, adding a segment when full;
+// the caller constructs the record there and then counts it
+void* DynamicArray::nextSlot() {
+    if (size == segmentCount * TRANSACTION_SEGMENT_SIZE) {
+        addSegment();
+    }
+    return &segments[size >> TRANSACTION_SEGMENT_SHIFT][size & (TRANSACTION_SEGMENT_SIZE - 1)];
 }
 
 void DynamicArray::push_back(const Transaction& trans) {
-    if (size >= capacity) {
-        resize();
+    emplace_back(trans);
+}
+
+void DynamicArray::push_back(Transaction&& trans) {
+    emplace_back(move(trans));
+}
+
+void DynamicArray::append(DynamicArray& other) {
+    if (&other == this || other.size == 0) return;
+
+    // Nothing to keep here, so take other's segments whole
+    if (size == 0) {
+        *this = move(other);
+        return;
+    }
+
+    reserve(size + other.size);
+    for (size_t i = 0; i < other.size; i++) {
+        emplace_back(move(other[i]));
     }
-    arr[size++] = trans;
+    other.clear();
+}
+
+void DynamicArray::reserve(size_t count) {
+    while (segmentCount * TRANSACTION_SEGMENT_SIZE < count) {
+        addSegment();
+    }
+}
+
+// Segments are raw storage, so the ones past the last record hold nothing to destroy
+void DynamicArray::shrink_to_fit() {
+    size_t needed = (size + TRANSACTION_SEGMENT_SIZE - 1) >> TRANSACTION_SEGMENT_SHIFT;
+    while (segmentCount > needed) {
+        ::operator delete(segments[--segmentCount]);
+    }
+
+    if (segmentCount == directoryCapacity) return;
+
+    Transaction** newSegments = nullptr;
+    if (segmentCount > 0) {
+        newSegments = new Transaction*[segmentCount];
+        for (size_t i = 0; i < segmentCount; i++) {
+            newSegments[i] = segments[i];
+        }
+    }
+    delete[] segments;
+    segments = newSegments;
+    directoryCapacity = segmentCount;
 }
 
 void DynamicArray::clear() {
-    size = 0; // Simply reset size, don't deallocate memory
+    destroyRecords(); // Keep the segments for reuse
 }
 
-Transaction& DynamicArray::operator[](int index) {
-    return arr[index];
+Transaction& DynamicArray::operator[](size_t index) {
+    return segments[index >> TRANSACTION_SEGMENT_SHIFT][index & (TRANSACTION_SEGMENT_SIZE - 1)];
 }
 
-const Transaction& DynamicArray::operator[](int index) const {
-    return arr[index];
+const Transaction& DynamicArray::operator[](size_t index) const {
+    return segments[index >> TRANSACTION_SEGMENT_SHIFT][index & (TRANSACTION_SEGMENT_SIZE - 1)];
 }
 
-int DynamicArray::getSize() const {
+size_t DynamicArray::getSize() const {
     return size;
 }
 
-// Channel Array Implementation (keep all your existing code)
-ChannelArray::ChannelArray() {
-    maxChannels = 20;
-    channelCount = 0;
-    channels = new DynamicArray[maxChannels];
-    channelNames = new string[maxChannels];
+size_t DynamicArray::getCapacity() const {
+    return segmentCount * TRANSACTION_SEGMENT_SIZE;
+}
+
+// ============= INDEX VECTOR =============
+
+const size_t INDEX_VECTOR_INITIAL_CAPACITY = 1024;
+
+IndexVector::IndexVector() : rows(nullptr), size(0), capacity(0) {}
+
+IndexVector::~IndexVector() {
+    delete[] rows;
+}
+
+void IndexVector::push_back(RowIndex row) {
+    if (size == capacity) {
+        reserve((capacity == 0) ? INDEX_VECTOR_INITIAL_CAPACITY : capacity * 2);
+    }
+    rows[size++] = row;
+}
+
+void IndexVector::reserve(size_t count) {
+    if (count <= capacity) return;
+
+    RowIndex* resized = new RowIndex[count];
+    for (size_t i = 0; i < size; i++) {
+        resized[i] = rows[i];
+    }
+    delete[] rows;
+    rows = resized;
+    capacity = count;
+}
+
+void IndexVector::clear() {
+    size = 0;
+}
+
+size_t IndexVector::getSize() const {
+    return size;
 }
 
+// ============= CHANNEL ARRAY (MASTER STORE + PARTITIONS) =============
+
+ChannelArray::ChannelArray(CategoryColumn column)
+    : channels(nullptr), slotCapacity(0), partitionColumn(column) {}
+
 ChannelArray::~ChannelArray() {
+    for (int i = 0; i < slotCapacity; i++) delete channels[i];
     delete[] channels;
-    delete[] channelNames;
 }
 
+// Adding a name that already exists is a no-op
 void ChannelArray::addChannel(const string& name) {
-    if (channelCount < maxChannels) {
-        channelNames[channelCount] = name;
-        channelCount++;
+    int channelIndex = partitionMap.add(name);
+    growPartitionSlots(channels, slotCapacity, channelIndex + 1);
+    if (channels[channelIndex] == nullptr) {
+        channels[channelIndex] = new IndexVector();
     }
 }
 
 int ChannelArray::findChannel(const string& name) const {
-    for (int i = 0; i < channelCount; i++) {
-        if (channelNames[i] == name) {
-            return i;
-        }
+    return partitionMap.find(name);
+}
+
+int ChannelArray::partitionFor(const Transaction& trans) {
+    CategoryCode code = categoryCodeOf(trans, partitionColumn);
+    int channelIndex = partitionMap.findCode(code);
+    if (channelIndex == -1) {
+        string name = partitionNameFor(partitionColumn, code);
+        addChannel(name);
+        channelIndex = partitionMap.find(name);
+        partitionMap.bindCode(code, channelIndex);
     }
-    return -1;
+    return channelIndex;
 }
 
-DynamicArray& ChannelArray::getChannel(int index) {
-    return channels[index];
+void ChannelArray::setPartitionColumn(CategoryColumn column) {
+    clear();
+    partitionColumn = column;
 }
 
-const DynamicArray& ChannelArray::getChannel(int index) const {
-    return channels[index];
+CategoryColumn ChannelArray::getPartitionColumn() const {
+    return partitionColumn;
 }
 
-string ChannelArray::getChannelName(int index) const {
-    if (index >= 0 && index < channelCount) {
-        return channelNames[index];
+// Checked before anything is added, so a rejected row or merge leaves the store as it was
+static void checkRowCount(size_t rowCount) {
+    if (rowCount > MAX_STORE_ROWS) {
+        throw length_error("master store is full: row indices are 32-bit");
     }
-    return "";
 }
 
-int ChannelArray::getChannelCount() const {
-    return channelCount;
+void ChannelArray::add(int channelIndex, const Transaction& trans) {
+    checkRowCount(records.getSize() + 1);
+    channels[channelIndex]->push_back((RowIndex)records.getSize());
+    records.push_back(trans);
 }
 
-// Keep your existing loadAndSeparateArray function with Null handling
-void loadAndSeparateArray(const string& filename, ChannelArray& channelArrays) {
-    cout << "\n=== Array Load & Split ===" << endl;
+void ChannelArray::add(int channelIndex, Transaction&& trans) {
+    checkRowCount(records.getSize() + 1);
+    channels[channelIndex]->push_back((RowIndex)records.getSize());
+    records.emplace_back(move(trans));
+}
 
-    ifstream file(filename);
-    if (!file.is_open()) {
-        cout << "Error: Cannot open file: " << filename << endl;
-        return;
+// Other's rows land after ours in their original order, and its row indices
+// are shifted by the rows already held
+void ChannelArray::append(ChannelArray& other) {
+    if (&other == this) return;
+    checkRowCount(records.getSize() + other.records.getSize());
+
+    RowIndex base = (RowIndex)records.getSize();
+    records.append(other.records);
+
+    for (int c = 0; c < other.getChannelCount(); c++) {
+        const string& name = other.partitionMap.name(c);
+        addChannel(name);
+        int channelIndex = findChannel(name);
+
+        const IndexVector& rows = *other.channels[c];
+        IndexVector& target = *channels[channelIndex];
+        target.reserve(target.getSize() + rows.getSize());
+        for (size_t i = 0; i < rows.getSize(); i++) {
+            target.push_back(base + rows[i]);
+        }
     }
+    other.clear();
+}
 
-    string line;
-    getline(file, line); // Skip header
+ChannelView ChannelArray::getChannel(int index) const {
+    return ChannelView(records, *channels[index]);
+}
 
-    int loadedCount = 0;
-    int skippedCount = 0;
-    auto startTime = high_resolution_clock::now();
+const DynamicArray& ChannelArray::getRecords() const {
+    return records;
+}
 
-    cout << "Processing and separating transactions directly into arrays..." << endl;
+size_t ChannelArray::getSize() const {
+    return records.getSize();
+}
 
-    while (getline(file, line)) {
-        if (line.empty()) continue;
+string ChannelArray::getChannelName(int index) const {
+    if (index >= 0 && index < partitionMap.size()) {
+        return partitionMap.name(index);
+    }
+    return "";
+}
 
-        stringstream ss(line);
-        Transaction trans;
-        string field;
+int ChannelArray::getChannelCount() const {
+    return partitionMap.size();
+}
 
-        try {
-            // More lenient parsing - handle "Null" values properly
-            getline(ss, trans.transaction_id, ',');
-            getline(ss, trans.timestamp, ',');
-            getline(ss, trans.sender_account, ',');
-            getline(ss, trans.receiver_account, ',');
-
-            getline(ss, field, ',');
-            if (field.empty() || field == "Null" || field == "NULL") {
-                trans.amount = 0.0;
-            } else {
-                try {
-                    trans.amount = stod(field);
-                } catch (...) {
-                    trans.amount = 0.0;
-                }
-            }
+// Empties the store and every partition so the same object can be reloaded;
+// the partition vectors are kept for reuse
+void ChannelArray::clear() {
+    records.clear();
+    for (int i = 0; i < partitionMap.size(); i++) {
+        channels[i]->clear();
+    }
+    partitionMap.clear();
+}
 
-            getline(ss, trans.transaction_type, ',');
-            if (trans.transaction_type == "Null" || trans.transaction_type == "NULL") {
-                trans.transaction_type = "Unknown";
-            }
+// Parses one chunk of CSV lines into a thread-local set of channel partitions
+static void parseChunkIntoChannels(CSVChunk chunk, ChannelArray* partitions, long long* loadedCount, long long* skippedCount, ParseStats* stats) {
+    CSVScanner scanner(chunk.begin, chunk.end - chunk.begin);
+    CategoryInternCache categoryCache;
+    string_view line;
 
-            getline(ss, trans.merchant_category, ',');
-            if (trans.merchant_category == "Null" || trans.merchant_category == "NULL") {
-                trans.merchant_category = "Unknown";
-            }
+    while (scanner.nextLine(line)) {
+        if (line.empty()) continue;
 
-            getline(ss, trans.location, ',');
-            if (trans.location == "Null" || trans.location == "NULL") {
-                trans.location = "Unknown";
-            }
+        Transaction trans;
 
-            getline(ss, trans.device_used, ',');
-            if (trans.device_used == "Null" || trans.device_used == "NULL") {
-                trans.device_used = "Unknown";
-            }
+        try {
+            parseTransactionFields(line, trans, stats, &categoryCache);
 
-            getline(ss, field, ',');
-            if (field == "Null" || field == "NULL" || field.empty()) {
-                trans.is_fraud = false;
-            } else {
-                trans.is_fraud = (field == "1" || field == "true" || field == "TRUE");
+            // Only skip if transaction_id is missing (less strict condition)
+            if (isMissingPrefixedKey(trans.transaction_id)) {
+                (*skippedCount)++;
+                continue;
             }
 
-            getline(ss, trans.fraud_type, ',');
-            if (trans.fraud_type == "Null" || trans.fraud_type == "NULL") {
-                trans.fraud_type = "";
-            }
+            int channelIndex = partitions->partitionFor(trans);
+            partitions->add(channelIndex, move(trans));
+            (*loadedCount)++;
 
-            getline(ss, field, ',');
-            if (field.empty() || field == "Null" || field == "NULL") {
-                trans.time_since_last_transaction = 0.0;
-            } else {
-                try {
-                    trans.time_since_last_transaction = stod(field);
-                } catch (...) {
-                    trans.time_since_last_transaction = 0.0;
-                }
-            }
+        } catch (const length_error&) {
+            stats->storeFullRows++;
+            (*skippedCount)++;
+        } catch (...) {
+            (*skippedCount)++;
+        }
+    }
+}
 
-            getline(ss, field, ',');
-            if (field.empty() || field == "Null" || field == "NULL") {
-                trans.spending_deviation_score = 0.0;
-            } else {
-                try {
-                    trans.spending_deviation_score = stod(field);
-                } catch (...) {
-                    trans.spending_deviation_score = 0.0;
-                }
-            }
+// Parallel load: per-thread channel partitions merged by channel
+void loadAndSeparateArray(const string& filename, ChannelArray& channelArrays, LoadMode mode) {
+    cout << "\n=== Array Load & Split ===" << endl;
 
-            getline(ss, field, ',');
-            if (field.empty() || field == "Null" || field == "NULL") {
-                trans.velocity_score = 0;
-            } else {
-                try {
-                    trans.velocity_score = stoi(field);
-                } catch (...) {
-                    trans.velocity_score = 0;
-                }
-            }
+    auto startTime = high_resolution_clock::now();
 
-            getline(ss, field, ',');
-            if (field.empty() || field == "Null" || field == "NULL") {
-                trans.geo_anomaly_score = 0.0;
-            } else {
-                try {
-                    trans.geo_anomaly_score = stod(field);
-                } catch (...) {
-                    trans.geo_anomaly_score = 0.0;
-                }
-            }
+    MappedFile input;
+    if (!input.open(filename, mode)) {
+        cout << "Error: Cannot open file: " << filename << endl;
+        return;
+    }
 
-            getline(ss, trans.payment_channel, ',');
-            if (trans.payment_channel == "Null" || trans.payment_channel == "NULL") {
-                trans.payment_channel = "Unknown";
-            }
+    CSVScanner scanner(input.data(), input.size());
+    string_view line;
+    scanner.nextLine(line); // Skip header
 
-            getline(ss, trans.ip_address, ',');
-            if (trans.ip_address == "Null" || trans.ip_address == "NULL") {
-                trans.ip_address = "";
-            }
+    long long loadedCount = 0;
+    long long skippedCount = 0;
+    ParseStats parseStats;
 
-            getline(ss, trans.device_hash);
-            if (trans.device_hash == "Null" || trans.device_hash == "NULL") {
-                trans.device_hash = "";
-            }
+    cout << "Processing and separating transactions directly into arrays..." << endl;
+    cout << "Input: " << (input.isMapped() ? "memory-mapped" : "buffered") << ", " << input.size() / 1024 << " KB, " << getDelimiterKernelName() << " delimiter scan" << endl;
 
-            // Only skip if transaction_id is missing (less strict condition)
-            if (trans.transaction_id.empty() || trans.transaction_id == "Null") {
-                skippedCount++;
-                continue;
-            }
+    // Split the body at newline boundaries and parse each chunk on its own core
+    int threadCount = getLoaderThreadCount(input.size());
+    CSVChunk* chunks = new CSVChunk[threadCount];
+    const char* bodyStart = scanner.position();
+    int chunkCount = splitIntoLineChunks(bodyStart, input.data() + input.size() - bodyStart, threadCount, chunks);
 
-            // Direct separation during loading
-            string channel = trans.payment_channel.empty() ? "Unknown" : trans.payment_channel;
+    cout << "Worker threads: " << chunkCount << endl;
 
-            // Find or create channel
-            int channelIndex = channelArrays.findChannel(channel);
-            if (channelIndex == -1) {
-                channelArrays.addChannel(channel);
-                channelIndex = channelArrays.getChannelCount() - 1;
-            }
+    ChannelArray* partitions = new ChannelArray[chunkCount];
+    for (int i = 0; i < chunkCount; i++) {
+        partitions[i].setPartitionColumn(channelArrays.getPartitionColumn());
+    }
+    long long* chunkLoaded = new long long[chunkCount]();
+    long long* chunkSkipped = new long long[chunkCount]();
+    ParseStats* chunkStats = new ParseStats[chunkCount];
+    thread* workers = new thread[chunkCount];
 
-            // Add directly to appropriate channel array
-            channelArrays.getChannel(channelIndex).push_back(trans);
-            loadedCount++;
+    for (int i = 0; i < chunkCount; i++) {
+        workers[i] = thread(parseChunkIntoChannels, chunks[i], &partitions[i], &chunkLoaded[i], &chunkSkipped[i], &chunkStats[i]);
+    }
+    for (int i = 0; i < chunkCount; i++) {
+        workers[i].join();
+    }
 
-        } catch (...) {
-            skippedCount++;
-            continue;
+    // Merge partitions in chunk order so file order and channel order are preserved
+    for (int i = 0; i < chunkCount; i++) {
+        try {
+            channelArrays.append(partitions[i]);
+            loadedCount += chunkLoaded[i];
+        } catch (const length_error&) {
+            parseStats.storeFullRows += chunkLoaded[i];
+            skippedCount += chunkLoaded[i];
         }
+        skippedCount += chunkSkipped[i];
+        parseStats.merge(chunkStats[i]);
     }
 
+    delete[] workers;
+    delete[] chunkStats;
+    delete[] chunkSkipped;
+    delete[] chunkLoaded;
+    delete[] partitions;
+    delete[] chunks;
+
     auto endTime = high_resolution_clock::now();
     auto duration = duration_cast<milliseconds>(endTime - startTime);
 
-    file.close();
-
     cout << "Summarizing..." << endl;
     cout << "\nSuccessfully processed: " << loadedCount << " transactions" << endl;
     if (skippedCount > 0) {
         cout << "Skipped due to errors: " << skippedCount << " transactions" << endl;
     }
-    cout << "Payment Channels: " << channelArrays.getChannelCount() << "" << endl;
+    displayParseStats(parseStats);
+    cout << partitionColumnLabel(channelArrays.getPartitionColumn()) << " partitions: " << channelArrays.getChannelCount() << endl;
     cout << "Total time: " << duration.count() << " ms" << endl;
-    cout << "Performance: " << (loadedCount * 1000) / duration.count() << " transactions/second" << endl;
+    if (duration.count() > 0) {
+        cout << "Performance: " << (loadedCount * 1000LL) / duration.count() << " transactions/second" << endl;
+    }
 }
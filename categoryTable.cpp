@@ -0,0 +1,104 @@
+#include "fileManager.h"
+
+CategoryTable categoryTable;
+
+// ============= CATEGORY INTERN TABLE =============
+
+CategoryTable::CategoryTable() {
+    for (int column = 0; column < CATEGORY_COLUMN_COUNT; column++) {
+        dictionaries[column].intern("");    // CATEGORY_EMPTY_CODE
+        ranks[column] = nullptr;
+        ranksStale[column] = true;
+    }
+}
+
+CategoryTable::~CategoryTable() {
+    for (int column = 0; column < CATEGORY_COLUMN_COUNT; column++) {
+        delete[] ranks[column];
+    }
+}
+
+CategoryCode CategoryTable::intern(CategoryColumn column, string_view value) {
+    lock_guard<mutex> guard(internLock);
+
+    int before = dictionaries[column].size();
+    int code = dictionaries[column].intern(value);
+    if (dictionaries[column].size() != before) {
+        ranksStale[column] = true;
+    }
+    return (CategoryCode)code;
+}
+
+int CategoryTable::find(CategoryColumn column, string_view value) const {
+    lock_guard<mutex> guard(internLock);
+    return dictionaries[column].find(value);
+}
+
+int CategoryTable::size(CategoryColumn column) const {
+    lock_guard<mutex> guard(internLock);
+    return dictionaries[column].size();
+}
+
+// Radix-sorts the codes case-insensitively (same order as fastStringCompare) and
+// numbers them; values equal apart from case share a rank
+void CategoryTable::refreshRanks(CategoryColumn column) {
+    lock_guard<mutex> guard(internLock);
+
+    const StringDictionary& dictionary = dictionaries[column];
+    int count = dictionary.size();
+    int* order = new int[count];
+    for (int i = 0; i < count; i++) order[i] = i;
+
+    msdRadixSort(order, (size_t)count, [&dictionary](int code) -> const string& { return dictionary.lookup(code); });
+
+    delete[] ranks[column];
+    ranks[column] = new uint32_t[count];
+
+    uint32_t currentRank = 0;
+    for (int i = 0; i < count; i++) {
+        if (i > 0 && fastStringCompare(dictionary.lookup(order[i - 1]).c_str(), dictionary.lookup(order[i]).c_str()) < 0) {
+            currentRank++;
+        }
+        ranks[column][order[i]] = currentRank;
+    }
+
+    delete[] order;
+    ranksStale[column] = false;
+}
+
+// ============= PER-THREAD INTERN CACHE =============
+
+CategoryInternCache::CategoryInternCache() {
+    for (int column = 0; column < CATEGORY_COLUMN_COUNT; column++) {
+        globalCodes[column] = nullptr;
+        capacity[column] = 0;
+    }
+}
+
+CategoryInternCache::~CategoryInternCache() {
+    for (int column = 0; column < CATEGORY_COLUMN_COUNT; column++) {
+        delete[] globalCodes[column];
+    }
+}
+
+CategoryCode CategoryInternCache::intern(CategoryColumn column, string_view value) {
+    int local = seen[column].find(value);
+    if (local != -1) {
+        return globalCodes[column][local];
+    }
+
+    CategoryCode code = categoryTable.intern(column, value);
+    local = seen[column].intern(value);
+
+    if (local == capacity[column]) {
+        int newCapacity = (capacity[column] == 0) ? 16 : capacity[column] * 2;
+        CategoryCode* grown = new CategoryCode[newCapacity];
+        for (int i = 0; i < capacity[column]; i++) grown[i] = globalCodes[column][i];
+        delete[] globalCodes[column];
+        globalCodes[column] = grown;
+        capacity[column] = newCapacity;
+    }
+
+    globalCodes[column][local] = code;
+    return code;
+}
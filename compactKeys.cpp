@@ -0,0 +1,170 @@
+#include "fileManager.h"
+
+FallbackStringTable fallbackStrings;
+
+// ============= FALLBACK STRING TABLE =============
+
+FallbackStringTable::FallbackStringTable() {
+    dictionary.intern("");  // index 0, the default for every key type
+}
+
+uint32_t FallbackStringTable::intern(string_view value) {
+    lock_guard<mutex> guard(internLock);
+    return (uint32_t)dictionary.intern(value);
+}
+
+// ============= PREFIXED KEYS (IDS, ACCOUNTS) =============
+
+// At most 18 digits, so any value fits below the fallback bit
+const size_t PREFIXED_KEY_MAX_DIGITS = 18;
+
+// Only the canonical form is encoded (no sign, no leading zeros) so that
+// formatting gives back exactly the text that was read
+PrefixedKey encodePrefixedKey(string_view value, const char* prefix) {
+    size_t prefixLength = strlen(prefix);
+
+    if (value.size() > prefixLength && value.compare(0, prefixLength, prefix) == 0) {
+        string_view digits = value.substr(prefixLength);
+
+        if (digits.size() <= PREFIXED_KEY_MAX_DIGITS && (digits[0] != '0' || digits.size() == 1)) {
+            uint64_t number = 0;
+            size_t i = 0;
+            while (i < digits.size() && digits[i] >= '0' && digits[i] <= '9') {
+                number = number * 10 + (uint64_t)(digits[i] - '0');
+                i++;
+            }
+            if (i == digits.size()) {
+                return number;
+            }
+        }
+    }
+
+    return PREFIXED_KEY_FALLBACK | fallbackStrings.intern(value);
+}
+
+void appendPrefixedKey(string& out, PrefixedKey key, const char* prefix) {
+    if (key & PREFIXED_KEY_FALLBACK) {
+        out += fallbackStrings.lookup((uint32_t)(key & ~PREFIXED_KEY_FALLBACK));
+        return;
+    }
+
+    char digits[24];
+    to_chars_result result = to_chars(digits, digits + sizeof(digits), key);
+    out += prefix;
+    out.append(digits, result.ptr - digits);
+}
+
+string formatPrefixedKey(PrefixedKey key, const char* prefix) {
+    string text;
+    appendPrefixedKey(text, key, prefix);
+    return text;
+}
+
+bool isMissingPrefixedKey(PrefixedKey key) {
+    if (!(key & PREFIXED_KEY_FALLBACK)) return false;
+
+    const string& text = fallbackStrings.lookup((uint32_t)(key & ~PREFIXED_KEY_FALLBACK));
+    return text.empty() || text == "Null";
+}
+
+// ============= IPV4 ADDRESSES =============
+
+// Canonical dotted quad only: four octets 0-255 without leading zeros
+static bool parseIpv4(string_view value, uint32_t& address) {
+    address = 0;
+    size_t pos = 0;
+
+    for (int octet = 0; octet < 4; octet++) {
+        if (octet > 0) {
+            if (pos >= value.size() || value[pos] != '.') return false;
+            pos++;
+        }
+
+        size_t start = pos;
+        uint32_t part = 0;
+        while (pos < value.size() && pos - start < 3 && value[pos] >= '0' && value[pos] <= '9') {
+            part = part * 10 + (uint32_t)(value[pos] - '0');
+            pos++;
+        }
+
+        size_t length = pos - start;
+        if (length == 0 || part > 255 || (length > 1 && value[start] == '0')) return false;
+        address = (address << 8) | part;
+    }
+
+    return pos == value.size();
+}
+
+IpAddress encodeIpAddress(string_view value) {
+    IpAddress ip;
+    if (parseIpv4(value, ip.address)) {
+        ip.fallback = IP_ADDRESS_NUMERIC;
+    } else {
+        ip.address = 0;
+        ip.fallback = fallbackStrings.intern(value);
+    }
+    return ip;
+}
+
+void appendIpAddress(string& out, IpAddress ip) {
+    if (ip.fallback != IP_ADDRESS_NUMERIC) {
+        out += fallbackStrings.lookup(ip.fallback);
+        return;
+    }
+
+    char text[16];
+    char* cursor = text;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        cursor = to_chars(cursor, text + sizeof(text), (ip.address >> shift) & 0xFF).ptr;
+        if (shift > 0) *cursor++ = '.';
+    }
+    out.append(text, cursor - text);
+}
+
+string formatIpAddress(IpAddress ip) {
+    string text;
+    appendIpAddress(text, ip);
+    return text;
+}
+
+// ============= DEVICE HASHES =============
+
+DeviceHash encodeDeviceHash(string_view value) {
+    DeviceHash hash;
+    unsigned char bytes[DEVICE_HASH_INLINE_BYTES] = {0};
+
+    // Zero padding marks the end, so embedded zeros cannot be held inline
+    bool fitsInline = value.size() <= (size_t)DEVICE_HASH_INLINE_BYTES &&
+                      value.find('\0') == string_view::npos &&
+                      (value.empty() || (unsigned char)value[0] != DEVICE_HASH_FALLBACK_MARK);
+
+    if (fitsInline) {
+        if (!value.empty()) memcpy(bytes, value.data(), value.size());
+        memcpy(hash.words, bytes, sizeof(bytes));
+    } else {
+        bytes[0] = DEVICE_HASH_FALLBACK_MARK;
+        memcpy(&hash.words[0], bytes, sizeof(hash.words[0]));
+        hash.words[1] = fallbackStrings.intern(value);
+    }
+    return hash;
+}
+
+void appendDeviceHash(string& out, const DeviceHash& hash) {
+    unsigned char bytes[DEVICE_HASH_INLINE_BYTES];
+    memcpy(bytes, hash.words, sizeof(bytes));
+
+    if (bytes[0] == DEVICE_HASH_FALLBACK_MARK) {
+        out += fallbackStrings.lookup((uint32_t)hash.words[1]);
+        return;
+    }
+
+    size_t length = 0;
+    while (length < (size_t)DEVICE_HASH_INLINE_BYTES && bytes[length] != 0) length++;
+    out.append((const char*)bytes, length);
+}
+
+string formatDeviceHash(const DeviceHash& hash) {
+    string text;
+    appendDeviceHash(text, hash);
+    return text;
+}
@@ -1,15 +1,19 @@
 #include "fileManager.h"
 
-// Enhanced performance measurement with real memory tracking
-PerformanceMetrics measureArraySortPerformanceWithMemory(DynamicArray& arr, const string& algorithm) {
+// Container bytes are measured while each copy is filled; the algorithm's own
+// peak and allocation count are measured around the call itself
+static void recordAllocations(PerformanceMetrics& metrics, size_t baseMemory, const AllocationScope& scope) {
+    AllocationStats allocation = scope.stats();
+    metrics.memory_used = baseMemory + allocation.peakBytes;
+    metrics.allocation_count = allocation.allocations;
+}
+
+PerformanceMetrics measureArraySortPerformanceWithMemory(DynamicArray& arr, const string& algorithm, size_t baseMemory) {
     PerformanceMetrics metrics;
     metrics.algorithm_name = algorithm;
     metrics.data_structure = "Array";
 
-    size_t baseMemory = arr.getSize() * sizeof(Transaction);
-    size_t algorithmOverhead = calculateAlgorithmMemoryOverhead(algorithm, arr.getSize(), false);
-    size_t peakMemory = baseMemory + algorithmOverhead;
-
+    AllocationScope scope;
     auto startTime = high_resolution_clock::now();
 
     try {
@@ -19,32 +23,38 @@ PerformanceMetrics measureArraySortPerformanceWithMemory(DynamicArray& arr, cons
             quickSort(arr);
         } else if (algorithm == "Heap Sort") {
             heapSort(arr);
+        } else if (algorithm == "Counting Sort") {
+            countingSort(arr);
+        } else if (algorithm == "Radix Sort") {
+            radixSort(arr);
+        } else if (algorithm == "Parallel Merge") {
+            parallelMergeSort(arr);
         }
     } catch (...) {
         cout << "Error during " << algorithm << " on Array. Using fallback..." << endl;
         heapSort(arr);
-        algorithmOverhead = calculateAlgorithmMemoryOverhead("Heap Sort", arr.getSize(), false);
-        peakMemory = baseMemory + algorithmOverhead;
     }
 
     auto endTime = high_resolution_clock::now();
     auto duration = duration_cast<microseconds>(endTime - startTime);
 
     metrics.time_taken = duration.count() / 1000.0;
-    metrics.memory_used = peakMemory;
+    recordAllocations(metrics, baseMemory, scope);
 
     return metrics;
 }
 
-PerformanceMetrics measureLinkedListSortPerformanceWithMemory(SinglyLinkedList& list, const string& algorithm) {
+// Label for each linked-list variant
+static const char* listLabel(const SinglyLinkedList&) { return "Linked List"; }
+static const char* listLabel(const UnrolledLinkedList&) { return "Unrolled List"; }
+
+template <typename ListType>
+PerformanceMetrics measureLinkedListSortPerformanceWithMemory(ListType& list, const string& algorithm, size_t baseMemory) {
     PerformanceMetrics metrics;
     metrics.algorithm_name = algorithm;
-    metrics.data_structure = "Linked List";
-
-    size_t baseMemory = list.getSize() * sizeof(ListNode);
-    size_t algorithmOverhead = calculateAlgorithmMemoryOverhead(algorithm, list.getSize(), true);
-    size_t peakMemory = baseMemory + algorithmOverhead;
+    metrics.data_structure = listLabel(list);
 
+    AllocationScope scope;
     auto startTime = high_resolution_clock::now();
 
     try {
@@ -54,32 +64,101 @@ PerformanceMetrics measureLinkedListSortPerformanceWithMemory(SinglyLinkedList&
             quickSortLL(list);
         } else if (algorithm == "Heap Sort") {
             heapSortLL(list);
+        } else if (algorithm == "Counting Sort") {
+            countingSortLL(list);
+        } else if (algorithm == "Radix Sort") {
+            radixSortLL(list);
+        } else if (algorithm == "Parallel Merge") {
+            parallelMergeSortLL(list);
         }
     } catch (...) {
-        cout << "Error during " << algorithm << " on Linked List. Using fallback..." << endl;
+        cout << "Error during " << algorithm << " on " << listLabel(list) << ". Using fallback..." << endl;
         heapSortLL(list);
-        algorithmOverhead = calculateAlgorithmMemoryOverhead("Heap Sort", list.getSize(), true);
-        peakMemory = baseMemory + algorithmOverhead;
     }
 
     auto endTime = high_resolution_clock::now();
     auto duration = duration_cast<microseconds>(endTime - startTime);
 
     metrics.time_taken = duration.count() / 1000.0;
-    metrics.memory_used = peakMemory;
+    recordAllocations(metrics, baseMemory, scope);
 
     return metrics;
 }
 
-PerformanceMetrics measureArraySearchPerformanceWithMemory(const DynamicArray& arr, const string& algorithm, const string& searchTerm) {
+PerformanceMetrics measureStoreSortPerformanceWithMemory(TransactionStore& store, const string& algorithm, size_t baseMemory) {
     PerformanceMetrics metrics;
     metrics.algorithm_name = algorithm;
-    metrics.data_structure = "Array";
+    metrics.data_structure = "Columnar";
+
+    AllocationScope scope;
+    auto startTime = high_resolution_clock::now();
+
+    if (algorithm == "Merge Sort") {
+        mergeSortIterative(store);
+    } else if (algorithm == "Quick Sort") {
+        quickSort(store);
+    } else if (algorithm == "Heap Sort") {
+        heapSort(store);
+    } else if (algorithm == "Counting Sort") {
+        countingSort(store);
+    } else if (algorithm == "Radix Sort") {
+        radixSort(store);
+    } else if (algorithm == "Parallel Merge") {
+        parallelMergeSort(store);
+    }
+
+    auto endTime = high_resolution_clock::now();
+    auto duration = duration_cast<microseconds>(endTime - startTime);
+
+    metrics.time_taken = duration.count() / 1000.0;
+    recordAllocations(metrics, baseMemory, scope);
 
-    size_t baseMemory = arr.getSize() * sizeof(Transaction);
-    size_t algorithmOverhead = calculateAlgorithmMemoryOverhead(algorithm, arr.getSize(), false);
-    size_t peakMemory = baseMemory + algorithmOverhead;
+    return metrics;
+}
+
+// Sorts row indices over the master store; nothing is copied first, so the only
+// memory charged is what the sort itself allocates (keys and the sorted rows)
+PerformanceMetrics measureIndexSortPerformanceWithMemory(const ChannelView& view, const string& algorithm) {
+    PerformanceMetrics metrics;
+    metrics.algorithm_name = algorithm;
+    metrics.data_structure = "Row Index";
 
+    AllocationScope scope;
+    auto startTime = high_resolution_clock::now();
+
+    {
+        IndexVector sortedRows;
+        if (algorithm == "Merge Sort") {
+            mergeSortRows(view, sortedRows);
+        } else if (algorithm == "Quick Sort") {
+            quickSortRows(view, sortedRows);
+        } else if (algorithm == "Heap Sort") {
+            heapSortRows(view, sortedRows);
+        } else if (algorithm == "Counting Sort") {
+            countingSortRows(view, sortedRows);
+        } else if (algorithm == "Radix Sort") {
+            radixSortRows(view, sortedRows);
+        } else if (algorithm == "Parallel Merge") {
+            parallelMergeSortRows(view, sortedRows);
+        }
+    }
+
+    auto endTime = high_resolution_clock::now();
+    auto duration = duration_cast<microseconds>(endTime - startTime);
+
+    metrics.time_taken = duration.count() / 1000.0;
+    recordAllocations(metrics, 0, scope);
+
+    return metrics;
+}
+
+PerformanceMetrics measureArraySearchPerformanceWithMemory(const DynamicArray& arr, const string& algorithm, const string& searchTerm,
+                                                           size_t baseMemory) {
+    PerformanceMetrics metrics;
+    metrics.algorithm_name = algorithm;
+    metrics.data_structure = "Array";
+
+    AllocationScope scope;
     auto startTime = high_resolution_clock::now();
 
     if (algorithm == "Binary Search") {
@@ -94,20 +173,19 @@ PerformanceMetrics measureArraySearchPerformanceWithMemory(const DynamicArray& a
     auto duration = duration_cast<microseconds>(endTime - startTime);
 
     metrics.time_taken = duration.count() / 1000.0;
-    metrics.memory_used = peakMemory;
+    recordAllocations(metrics, baseMemory, scope);
 
     return metrics;
 }
 
-PerformanceMetrics measureLinkedListSearchPerformanceWithMemory(const SinglyLinkedList& list, const string& algorithm, const string& searchTerm) {
+template <typename ListType>
+PerformanceMetrics measureLinkedListSearchPerformanceWithMemory(const ListType& list, const string& algorithm, const string& searchTerm,
+                                                                size_t baseMemory) {
     PerformanceMetrics metrics;
     metrics.algorithm_name = algorithm;
-    metrics.data_structure = "Linked List";
-
-    size_t baseMemory = list.getSize() * sizeof(ListNode);
-    size_t algorithmOverhead = calculateAlgorithmMemoryOverhead(algorithm, list.getSize(), true);
-    size_t peakMemory = baseMemory + algorithmOverhead;
+    metrics.data_structure = listLabel(list);
 
+    AllocationScope scope;
     auto startTime = high_resolution_clock::now();
 
     if (algorithm == "Binary Search") {
@@ -122,204 +200,322 @@ PerformanceMetrics measureLinkedListSearchPerformanceWithMemory(const SinglyLink
     auto duration = duration_cast<microseconds>(endTime - startTime);
 
     metrics.time_taken = duration.count() / 1000.0;
-    metrics.memory_used = peakMemory;
+    recordAllocations(metrics, baseMemory, scope);
 
     return metrics;
 }
 
-void runSortingPerformanceTest(ChannelArray& channelArrays, ChannelListArray& channelLists) {
-    cout << "\n" << string(79, '=') << endl;
-    cout << "                           SORTING PERFORMANCE TEST" << endl;
-    cout << "                            (Sorting by Location)" << endl;
-    cout << string(79, '=') << endl;
+PerformanceMetrics measureStoreSearchPerformanceWithMemory(const TransactionStore& store, const string& algorithm, const string& searchTerm,
+                                                           size_t baseMemory) {
+    PerformanceMetrics metrics;
+    metrics.algorithm_name = algorithm;
+    metrics.data_structure = "Columnar";
+
+    AllocationScope scope;
+    auto startTime = high_resolution_clock::now();
+
+    if (algorithm == "Binary Search") {
+        binarySearch(store, searchTerm);
+    } else if (algorithm == "Interpolation Search") {
+        interpolationSearch(store, searchTerm);
+    } else if (algorithm == "Exponential Search") {
+        exponentialSearch(store, searchTerm);
+    }
 
-    DynamicArray testArray;
-    SinglyLinkedList testList;
+    auto endTime = high_resolution_clock::now();
+    auto duration = duration_cast<microseconds>(endTime - startTime);
 
-    int targetSize = 100000;
-    int addedCount = 0;
+    metrics.time_taken = duration.count() / 1000.0;
+    recordAllocations(metrics, baseMemory, scope);
 
-    for (int i = 0; i < channelArrays.getChannelCount() && addedCount < targetSize; i++) {
-        DynamicArray& channel = channelArrays.getChannel(i);
-        for (int j = 0; j < channel.getSize() && addedCount < targetSize; j++) {
-            testArray.push_back(channel[j]);
-            addedCount++;
+    return metrics;
+}
+
+// ============= TEST WORKING SETS =============
+
+// The first limit rows, channel by channel, as indices into the master store
+static void selectWorkingSet(const ChannelArray& channelArrays, IndexVector& rows, size_t limit) {
+    rows.reserve(minSize(channelArrays.getSize(), limit));
+
+    for (int i = 0; i < channelArrays.getChannelCount() && rows.getSize() < limit; i++) {
+        const IndexVector& channelRows = channelArrays.getChannel(i).getRows();
+        for (size_t j = 0; j < channelRows.getSize() && rows.getSize() < limit; j++) {
+            rows.push_back(channelRows[j]);
         }
     }
+}
 
-    addedCount = 0;
-    for (int i = 0; i < channelLists.getChannelCount() && addedCount < targetSize; i++) {
-        SinglyLinkedList& channel = channelLists.getChannel(i);
-        ListNode* current = channel.getHead();
-        while (current != nullptr && addedCount < targetSize) {
-            testList.push_back(current->data);
-            current = current->next;
-            addedCount++;
-        }
+// Builds the structure under test from the working set
+static void copyRows(const ChannelArray& channelArrays, const IndexVector& rows, DynamicArray& copy) {
+    const DynamicArray& records = channelArrays.getRecords();
+    copy.reserve(rows.getSize());
+    for (size_t i = 0; i < rows.getSize(); i++) {
+        copy.push_back(records[rows[i]]);
     }
+}
 
-    cout << "Testing with " << testArray.getSize() << " transactions" << endl;
-    //cout << "Checking how much memory each algorithm uses..." << endl;
+static void copyRows(const ChannelArray& channelArrays, const IndexVector& rows, TransactionStore& copy) {
+    copy.append(ChannelView(channelArrays.getRecords(), rows));
+}
 
-    PerformanceMetrics sortingMetrics[6];
+// Singly and unrolled lists are filled from the same rows as the array
+template <typename ListType>
+static void copyRows(const ChannelArray& channelArrays, const IndexVector& rows, ListType& copy) {
+    const DynamicArray& records = channelArrays.getRecords();
+    for (size_t i = 0; i < rows.getSize(); i++) {
+        copy.push_back(records[rows[i]]);
+    }
+}
 
-    DynamicArray arrayMerge, arrayQuick, arrayHeap;
-    SinglyLinkedList listMerge, listQuick, listHeap;
+// Heap bytes the copy holds once filled
+template <typename Container>
+static size_t copyRowsMeasured(const ChannelArray& channelArrays, const IndexVector& rows, Container& copy) {
+    AllocationScope scope;
+    copyRows(channelArrays, rows, copy);
+    long long live = scope.stats().liveBytes;
+    return (live > 0) ? (size_t)live : 0;
+}
 
-    for (int i = 0; i < testArray.getSize(); i++) {
-        arrayMerge.push_back(testArray[i]);
-        arrayQuick.push_back(testArray[i]);
-        arrayHeap.push_back(testArray[i]);
-    }
+template <typename ListType>
+static void runSortingComparison(const ChannelArray& channelArrays) {
+    cout << "\n" << string(79, '=') << endl;
+    cout << "                           SORTING PERFORMANCE TEST" << endl;
+    cout << "                            (Sorting by Location)" << endl;
+    cout << string(79, '=') << endl;
 
-    ListNode* current = testList.getHead();
-    while (current != nullptr) {
-        listMerge.push_back(current->data);
-        listQuick.push_back(current->data);
-        listHeap.push_back(current->data);
-        current = current->next;
-    }
+    const size_t targetSize = 100000;
+    const int algorithmCount = 6;
+    const char* algorithms[algorithmCount] = {"Merge Sort", "Quick Sort", "Heap Sort", "Counting Sort", "Radix Sort", "Parallel Merge"};
+
+    IndexVector workingSet;
+    selectWorkingSet(channelArrays, workingSet, targetSize);
+
+    cout << "Testing with " << workingSet.getSize() << " transactions" << endl;
+
+    const int structureCount = 4;
+    PerformanceMetrics sortingMetrics[algorithmCount * structureCount];
 
+    // Each structure is built from the working set right before it is measured and
+    // released right after, so only one copy of the test data is alive at a time.
+    // The columnar store is a third copy in structure-of-arrays form; the row
+    // index sort works on the master store directly.
     cout << "Comparing sorting algorithms and their memory usage..." << endl;
-    sortingMetrics[0] = measureArraySortPerformanceWithMemory(arrayMerge, "Merge Sort");
-    sortingMetrics[1] = measureLinkedListSortPerformanceWithMemory(listMerge, "Merge Sort");
-    sortingMetrics[2] = measureArraySortPerformanceWithMemory(arrayQuick, "Quick Sort");
-    sortingMetrics[3] = measureLinkedListSortPerformanceWithMemory(listQuick, "Quick Sort");
-    sortingMetrics[4] = measureArraySortPerformanceWithMemory(arrayHeap, "Heap Sort");
-    sortingMetrics[5] = measureLinkedListSortPerformanceWithMemory(listHeap, "Heap Sort");
-
-    cout << "\n" << string(90, '=') << endl;
+    for (int i = 0; i < algorithmCount; i++) {
+        {
+            DynamicArray testArray;
+            size_t arrayBytes = copyRowsMeasured(channelArrays, workingSet, testArray);
+            sortingMetrics[i * structureCount] = measureArraySortPerformanceWithMemory(testArray, algorithms[i], arrayBytes);
+        }
+        {
+            ListType testList;
+            size_t listBytes = copyRowsMeasured(channelArrays, workingSet, testList);
+            sortingMetrics[i * structureCount + 1] = measureLinkedListSortPerformanceWithMemory(testList, algorithms[i], listBytes);
+        }
+        {
+            TransactionStore testStore;
+            size_t storeBytes = copyRowsMeasured(channelArrays, workingSet, testStore);
+            sortingMetrics[i * structureCount + 2] = measureStoreSortPerformanceWithMemory(testStore, algorithms[i], storeBytes);
+        }
+        ChannelView workingView(channelArrays.getRecords(), workingSet);
+        sortingMetrics[i * structureCount + 3] = measureIndexSortPerformanceWithMemory(workingView, algorithms[i]);
+    }
+
+    cout << "\n" << string(100, '=') << endl;
     cout << "                             SORTING PERFORMANCE RESULTS" << endl;
-    cout << string(90, '=') << endl;
+    cout << string(100, '=') << endl;
     cout << left << setw(15) << "Algorithm"
          << setw(15) << "Data Structure"
          << setw(12) << "Time (ms)"
          << setw(15) << "Peak Mem (MB)"
+         << setw(10) << "Allocs"
          << setw(15) << "Time Diff (ms)"
          << setw(20) << "Memory Diff (MB)" << endl;
-    cout << string(90, '-') << endl;
+    cout << string(100, '-') << endl;
 
-    for (int i = 0; i < 3; i++) {
-        int arrayIndex = i * 2;
-        int listIndex = i * 2 + 1;
+    for (int i = 0; i < algorithmCount; i++) {
+        int arrayIndex = i * structureCount;
+        int listIndex = arrayIndex + 1;
+        int storeIndex = arrayIndex + 2;
+        int indexIndex = arrayIndex + 3;
         double timeDiff = absDouble(sortingMetrics[arrayIndex].time_taken - sortingMetrics[listIndex].time_taken);
 
         double arrayMemMB = (double)(sortingMetrics[arrayIndex].memory_used) / (1024.0 * 1024.0);
         double listMemMB = (double)(sortingMetrics[listIndex].memory_used) / (1024.0 * 1024.0);
+        double storeMemMB = (double)(sortingMetrics[storeIndex].memory_used) / (1024.0 * 1024.0);
+        double indexMemMB = (double)(sortingMetrics[indexIndex].memory_used) / (1024.0 * 1024.0);
         double memoryDiff = absDouble(arrayMemMB - listMemMB);
 
         cout << left << setw(15) << sortingMetrics[arrayIndex].algorithm_name
              << setw(15) << "Array"
              << setw(13) << fixed << setprecision(2) << sortingMetrics[arrayIndex].time_taken
              << setw(15) << fixed << setprecision(1) << arrayMemMB
+             << setw(10) << sortingMetrics[arrayIndex].allocation_count
              << setw(16) << fixed << setprecision(2) << timeDiff
              << setw(20) << fixed << setprecision(1) << memoryDiff << endl;
 
         cout << left << setw(15) << ""
-             << setw(15) << "Linked List"
+             << setw(15) << sortingMetrics[listIndex].data_structure
              << setw(12) << fixed << setprecision(2) << sortingMetrics[listIndex].time_taken
-             << setw(20) << fixed << setprecision(1) << listMemMB
+             << setw(15) << fixed << setprecision(1) << listMemMB
+             << setw(10) << sortingMetrics[listIndex].allocation_count
+             << setw(15) << ""
+             << setw(20) << "" << endl;
+
+        cout << left << setw(15) << ""
+             << setw(15) << sortingMetrics[storeIndex].data_structure
+             << setw(12) << fixed << setprecision(2) << sortingMetrics[storeIndex].time_taken
+             << setw(15) << fixed << setprecision(1) << storeMemMB
+             << setw(10) << sortingMetrics[storeIndex].allocation_count
+             << setw(15) << ""
+             << setw(20) << "" << endl;
+
+        cout << left << setw(15) << ""
+             << setw(15) << sortingMetrics[indexIndex].data_structure
+             << setw(12) << fixed << setprecision(2) << sortingMetrics[indexIndex].time_taken
+             << setw(15) << fixed << setprecision(1) << indexMemMB
+             << setw(10) << sortingMetrics[indexIndex].allocation_count
              << setw(15) << ""
              << setw(20) << "" << endl;
-        cout << string(90, '-') << endl;
+        cout << string(100, '-') << endl;
     }
 
     cout << "Memory tracking completed! Algorithm analysis ready." << endl;
 }
 
-void runSearchingPerformanceTest(ChannelArray& channelArrays, ChannelListArray& channelLists, const string& searchTerm) {
+void runSortingPerformanceTest(const ChannelArray& channelArrays, ListVariant variant) {
+    if (variant == LIST_UNROLLED) {
+        runSortingComparison<UnrolledLinkedList>(channelArrays);
+    } else {
+        runSortingComparison<SinglyLinkedList>(channelArrays);
+    }
+}
+
+template <typename ListType>
+static void runSearchingComparison(const ChannelArray& channelArrays, const string& searchTerm) {
     cout << "\n" << string(80, '=') << endl;
     cout << "                        SEARCHING PERFORMANCE TEST" << endl;
     cout << "                      (Searching by Transaction Type)" << endl;
     cout << string(80, '=') << endl;
 
-    PerformanceMetrics searchingMetrics[6];
+    PerformanceMetrics searchingMetrics[9];
+    const char* algorithms[3] = {"Binary Search", "Interpolation Search", "Exponential Search"};
 
-    DynamicArray searchArray;
-    SinglyLinkedList searchList;
+    const size_t maxSearchSize = 100000;
+    IndexVector workingSet;
+    selectWorkingSet(channelArrays, workingSet, maxSearchSize);
 
-    int maxSearchSize = 100000;
-    int totalAdded = 0;
+    cout << "Sorting data by transaction type..." << endl;
+    cout << "Searching for validated term: '" << searchTerm << "'..." << endl;
 
-    for (int i = 0; i < channelArrays.getChannelCount() && totalAdded < maxSearchSize; i++) {
-        DynamicArray& channel = channelArrays.getChannel(i);
-        for (int j = 0; j < channel.getSize() && totalAdded < maxSearchSize; j++) {
-            searchArray.push_back(channel[j]);
-            totalAdded++;
+    // As with sorting, one searchable copy of the working set is alive at a time
+    {
+        DynamicArray searchArray;
+        size_t arrayBytes = copyRowsMeasured(channelArrays, workingSet, searchArray);
+
+        try {
+            if (searchArray.getSize() > 0) {
+                mergeSortIterativeByTransactionType(searchArray);
+            }
+        } catch (...) {
+            cout << "Error during sorting. Aborting search test..." << endl;
+            return;
         }
-    }
 
-    totalAdded = 0;
-    for (int i = 0; i < channelLists.getChannelCount() && totalAdded < maxSearchSize; i++) {
-        SinglyLinkedList& channel = channelLists.getChannel(i);
-        ListNode* current = channel.getHead();
-        while (current != nullptr && totalAdded < maxSearchSize) {
-            searchList.push_back(current->data);
-            current = current->next;
-            totalAdded++;
+        for (int i = 0; i < 3; i++) {
+            searchingMetrics[i * 3] = measureArraySearchPerformanceWithMemory(searchArray, algorithms[i], searchTerm, arrayBytes);
         }
     }
-
-    cout << "Sorting data by transaction type..." << endl;
-
-    try {
-        if (searchArray.getSize() > 0) {
-            mergeSortIterativeByTransactionType(searchArray);
+    {
+        ListType searchList;
+        size_t listBytes = copyRowsMeasured(channelArrays, workingSet, searchList);
+
+        try {
+            if (searchList.getSize() > 0) {
+                mergeSortLLSafeByTransactionType(searchList);
+            }
+        } catch (...) {
+            cout << "Error during sorting. Aborting search test..." << endl;
+            return;
         }
 
-        if (searchList.getSize() > 0) {
-            mergeSortLLSafeByTransactionType(searchList);
+        for (int i = 0; i < 3; i++) {
+            searchingMetrics[i * 3 + 1] = measureLinkedListSearchPerformanceWithMemory(searchList, algorithms[i], searchTerm, listBytes);
         }
-    } catch (...) {
-        cout << "Error during sorting. Aborting search test..." << endl;
-        return;
     }
+    {
+        TransactionStore searchStore;
+        size_t storeBytes = copyRowsMeasured(channelArrays, workingSet, searchStore);
 
-    //cout << "Testing search algorithms with memory tracking on " << searchArray.getSize() << " transactions..." << endl;
-    cout << "Searching for validated term: '" << searchTerm << "'..." << endl;
+        if (searchStore.getSize() > 0) {
+            mergeSortIterativeByTransactionType(searchStore);
+        }
 
-    searchingMetrics[0] = measureArraySearchPerformanceWithMemory(searchArray, "Binary Search", searchTerm);
-    searchingMetrics[1] = measureLinkedListSearchPerformanceWithMemory(searchList, "Binary Search", searchTerm);
-    searchingMetrics[2] = measureArraySearchPerformanceWithMemory(searchArray, "Interpolation Search", searchTerm);
-    searchingMetrics[3] = measureLinkedListSearchPerformanceWithMemory(searchList, "Interpolation Search", searchTerm);
-    searchingMetrics[4] = measureArraySearchPerformanceWithMemory(searchArray, "Exponential Search", searchTerm);
-    searchingMetrics[5] = measureLinkedListSearchPerformanceWithMemory(searchList, "Exponential Search", searchTerm);
+        for (int i = 0; i < 3; i++) {
+            searchingMetrics[i * 3 + 2] = measureStoreSearchPerformanceWithMemory(searchStore, algorithms[i], searchTerm, storeBytes);
+        }
+    }
 
     cout << "\nSearch completed successfully - '" << searchTerm << "' found in dataset!" << endl;
 
-    cout << "\n" << string(99, '=') << endl;
+    cout << "\n" << string(109, '=') << endl;
     cout << "                                       SEARCHING PERFORMANCE RESULTS" << endl;
-    cout << string(99, '=') << endl;
+    cout << string(109, '=') << endl;
     cout << left << setw(22) << "Algorithm"
          << setw(15) << "Data Structure"
          << setw(13) << "Time (ms)"
          << setw(15) << "Peak Mem (MB)"
+         << setw(10) << "Allocs"
          << setw(16) << "Time Diff (ms)"
          << setw(20) << "Memory Diff (MB)" << endl;
-    cout << string(99, '-') << endl;
+    cout << string(109, '-') << endl;
 
     for (int i = 0; i < 3; i++) {
-        int arrayIndex = i * 2;
-        int listIndex = i * 2 + 1;
+        int arrayIndex = i * 3;
+        int listIndex = i * 3 + 1;
+        int storeIndex = i * 3 + 2;
         double timeDiff = absDouble(searchingMetrics[arrayIndex].time_taken - searchingMetrics[listIndex].time_taken);
 
         double arrayMemMB = (double)(searchingMetrics[arrayIndex].memory_used) / (1024.0 * 1024.0);
         double listMemMB = (double)(searchingMetrics[listIndex].memory_used) / (1024.0 * 1024.0);
+        double storeMemMB = (double)(searchingMetrics[storeIndex].memory_used) / (1024.0 * 1024.0);
         double memoryDiff = absDouble(arrayMemMB - listMemMB);
 
         cout << left << setw(22) << searchingMetrics[arrayIndex].algorithm_name
              << setw(15) << "Array"
              << setw(13) << fixed << setprecision(2) << searchingMetrics[arrayIndex].time_taken
              << setw(15) << fixed << setprecision(1) << arrayMemMB
+             << setw(10) << searchingMetrics[arrayIndex].allocation_count
              << setw(16) << fixed << setprecision(2) << timeDiff
              << setw(20) << fixed << setprecision(1) << memoryDiff << endl;
 
         cout << left << setw(22) << ""
-             << setw(15) << "Linked List"
+             << setw(15) << searchingMetrics[listIndex].data_structure
              << setw(13) << fixed << setprecision(4) << searchingMetrics[listIndex].time_taken
              << setw(15) << fixed << setprecision(1) << listMemMB
+             << setw(10) << searchingMetrics[listIndex].allocation_count
+             << setw(16) << ""
+             << setw(20) << "" << endl;
+
+        cout << left << setw(22) << ""
+             << setw(15) << searchingMetrics[storeIndex].data_structure
+             << setw(13) << fixed << setprecision(4) << searchingMetrics[storeIndex].time_taken
+             << setw(15) << fixed << setprecision(1) << storeMemMB
+             << setw(10) << searchingMetrics[storeIndex].allocation_count
              << setw(16) << ""
              << setw(20) << "" << endl;
-        cout << string(99, '-') << endl;
+        cout << string(109, '-') << endl;
     }
 }
+
+void runSearchingPerformanceTest(const ChannelArray& channelArrays, const string& searchTerm, ListVariant variant) {
+    if (variant == LIST_UNROLLED) {
+        runSearchingComparison<UnrolledLinkedList>(channelArrays, searchTerm);
+    } else {
+        runSearchingComparison<SinglyLinkedList>(channelArrays, searchTerm);
+    }
+}
+
+ListVariant promptListVariant() {
+    cout << "Linked list variant (1=Singly linked, 2=Unrolled): ";
+    return (getSafeIntegerInput(1, 2) == 2) ? LIST_UNROLLED : LIST_SINGLY;
+}
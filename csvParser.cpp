@@ -0,0 +1,364 @@
+#include "fileManager.h"
+
+// ============= RAW BUFFER LOADING =============
+
+bool readFileToBuffer(const string& filename, string& buffer) {
+    ifstream file(filename, ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file.seekg(0, ios::end);
+    streamoff length = file.tellg();
+    file.seekg(0, ios::beg);
+
+    if (length <= 0) {
+        buffer.clear();
+        return true;
+    }
+
+    buffer.resize((size_t)length);
+    file.read(&buffer[0], length);
+    buffer.resize((size_t)file.gcount());
+    file.close();
+    return true;
+}
+
+// ============= CSV SCANNER =============
+
+CSVScanner::CSVScanner(const char* data, size_t length) {
+    cursor = data;
+    end = data + length;
+}
+
+// Hands out one line at a time as a view into the buffer (no copying)
+bool CSVScanner::nextLine(string_view& line) {
+    if (cursor >= end) return false;
+
+    const char* lineStart = cursor;
+    const char* lineEnd = findNewline(cursor, end);
+
+    if (lineEnd == nullptr) {
+        lineEnd = end;
+        cursor = end;
+    } else {
+        cursor = lineEnd + 1;
+    }
+
+    // Tolerate Windows line endings
+    if (lineEnd > lineStart && *(lineEnd - 1) == '\r') {
+        lineEnd--;
+    }
+
+    line = string_view(lineStart, lineEnd - lineStart);
+    return true;
+}
+
+bool CSVScanner::atEnd() const {
+    return cursor >= end;
+}
+
+const char* CSVScanner::position() const {
+    return cursor;
+}
+
+// ============= CHUNKING FOR PARALLEL LOADING =============
+
+// One worker per core, but never hand a thread less than 1 MB of input
+int getLoaderThreadCount(size_t dataSize) {
+    const size_t minChunkBytes = 1024 * 1024;
+
+    int hardwareThreads = (int)thread::hardware_concurrency();
+    if (hardwareThreads <= 0) hardwareThreads = 1;
+
+    size_t bySize = dataSize / minChunkBytes;
+    if (bySize < 1) bySize = 1;
+
+    return (bySize < (size_t)hardwareThreads) ? (int)bySize : hardwareThreads;
+}
+
+// Splits the buffer into at most maxChunks pieces that each end on a newline,
+// so every chunk holds whole CSV lines. Returns the number of chunks.
+int splitIntoLineChunks(const char* data, size_t length, int maxChunks, CSVChunk chunks[]) {
+    if (length == 0 || maxChunks <= 0) return 0;
+
+    const char* end = data + length;
+    const char* chunkStart = data;
+    size_t targetSize = length / maxChunks;
+    int count = 0;
+
+    while (chunkStart < end && count < maxChunks) {
+        const char* chunkEnd = end;
+
+        if (count < maxChunks - 1 && (size_t)(end - chunkStart) > targetSize) {
+            const char* newline = findNewline(chunkStart + targetSize, end);
+            chunkEnd = (newline == nullptr) ? end : newline + 1;
+        }
+
+        chunks[count].begin = chunkStart;
+        chunks[count].end = chunkEnd;
+        count++;
+        chunkStart = chunkEnd;
+    }
+    return count;
+}
+
+// Splits a line on commas, 32 bytes at a time using the delimiter kernel.
+// The last field takes the remainder of the line, missing trailing fields are left empty.
+int splitCSVFields(string_view line, string_view fields[], int maxFields) {
+    int count = 0;
+    size_t start = 0;
+    size_t blockStart = 0;
+    const char* data = line.data();
+
+    while (blockStart < line.size() && count < maxFields - 1) {
+        size_t blockLength = line.size() - blockStart;
+        if (blockLength > (size_t)DELIMITER_BLOCK_SIZE) blockLength = DELIMITER_BLOCK_SIZE;
+
+        uint32_t commas = scanDelimiters(data + blockStart, blockLength).commas;
+        while (commas != 0 && count < maxFields - 1) {
+            size_t comma = blockStart + countTrailingZeros(commas);
+            fields[count++] = line.substr(start, comma - start);
+            start = comma + 1;
+            commas &= commas - 1;
+        }
+        blockStart += blockLength;
+    }
+
+    if (start <= line.size() && count < maxFields) {
+        fields[count++] = line.substr(start);
+    }
+
+    for (int i = count; i < maxFields; i++) {
+        fields[i] = string_view();
+    }
+    return count;
+}
+
+// ============= FIELD CONVERSION =============
+
+const char* const TRANSACTION_COLUMN_NAMES[TRANSACTION_FIELD_COUNT] = {
+    "transaction_id", "timestamp", "sender_account", "receiver_account",
+    "amount", "transaction_type", "merchant_category", "location",
+    "device_used", "is_fraud", "fraud_type", "time_since_last_transaction",
+    "spending_deviation_score", "velocity_score", "geo_anomaly_score",
+    "payment_channel", "ip_address", "device_hash"
+};
+
+ParseStats::ParseStats() {
+    nullNumericCells = 0;
+    storeFullRows = 0;
+    for (int i = 0; i < TRANSACTION_FIELD_COUNT; i++) {
+        malformedCells[i] = 0;
+    }
+}
+
+void ParseStats::record(int column, NumericParseResult result) {
+    if (result == NUMERIC_NULL) {
+        nullNumericCells++;
+    } else if (result == NUMERIC_MALFORMED) {
+        malformedCells[column]++;
+    }
+}
+
+void ParseStats::merge(const ParseStats& other) {
+    nullNumericCells += other.nullNumericCells;
+    storeFullRows += other.storeFullRows;
+    for (int i = 0; i < TRANSACTION_FIELD_COUNT; i++) {
+        malformedCells[i] += other.malformedCells[i];
+    }
+}
+
+int ParseStats::totalMalformed() const {
+    int total = 0;
+    for (int i = 0; i < TRANSACTION_FIELD_COUNT; i++) {
+        total += malformedCells[i];
+    }
+    return total;
+}
+
+static inline bool isNullField(string_view field) {
+    return field == "Null" || field == "NULL";
+}
+
+// Strips surrounding spaces and a leading '+', which from_chars does not accept
+static inline string_view trimNumber(string_view field) {
+    while (!field.empty() && (field.front() == ' ' || field.front() == '\t')) field.remove_prefix(1);
+    while (!field.empty() && (field.back() == ' ' || field.back() == '\t')) field.remove_suffix(1);
+    if (field.size() > 1 && field.front() == '+') field.remove_prefix(1);
+    return field;
+}
+
+// Allocation- and exception-free numeric parsing straight from the buffer.
+// A cell with trailing garbage keeps its leading number (like stod) but is reported as malformed.
+NumericParseResult parseDoubleView(string_view field, double& value) {
+    value = 0.0;
+    field = trimNumber(field);
+    if (field.empty() || isNullField(field)) return NUMERIC_NULL;
+
+    const char* first = field.data();
+    const char* last = first + field.size();
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    from_chars_result result = from_chars(first, last, value);
+    if (result.ec != errc() || result.ptr == first) {
+        value = 0.0;
+        return NUMERIC_MALFORMED;
+    }
+    return (result.ptr == last) ? NUMERIC_OK : NUMERIC_MALFORMED;
+#else
+    // strtod needs a terminated string; numeric cells are short so a stack copy is enough
+    char local[64];
+    if (field.size() >= sizeof(local)) return NUMERIC_MALFORMED;
+    memcpy(local, first, field.size());
+    local[field.size()] = '\0';
+
+    char* parsedEnd = nullptr;
+    value = strtod(local, &parsedEnd);
+    if (parsedEnd == local) {
+        value = 0.0;
+        return NUMERIC_MALFORMED;
+    }
+    return (*parsedEnd == '\0') ? NUMERIC_OK : NUMERIC_MALFORMED;
+#endif
+}
+
+NumericParseResult parseIntView(string_view field, int& value) {
+    value = 0;
+    field = trimNumber(field);
+    if (field.empty() || isNullField(field)) return NUMERIC_NULL;
+
+    const char* first = field.data();
+    const char* last = first + field.size();
+
+    from_chars_result result = from_chars(first, last, value);
+    if (result.ec != errc() || result.ptr == first) {
+        value = 0;
+        return NUMERIC_MALFORMED;
+    }
+    return (result.ptr == last) ? NUMERIC_OK : NUMERIC_MALFORMED;
+}
+
+// Reads exactly count digits starting at pos
+static inline bool readDigits(string_view field, size_t pos, size_t count, int& value) {
+    if (pos + count > field.size()) return false;
+    value = 0;
+    for (size_t i = pos; i < pos + count; i++) {
+        if (field[i] < '0' || field[i] > '9') return false;
+        value = value * 10 + (field[i] - '0');
+    }
+    return true;
+}
+
+// Days since 1970-01-01 for a proleptic Gregorian date (Howard Hinnant's days_from_civil)
+static inline int64_t daysFromCivil(int year, int month, int day) {
+    year -= (month <= 2) ? 1 : 0;
+    int era = (year >= 0 ? year : year - 399) / 400;
+    int yearOfEra = year - era * 400;
+    int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return (int64_t)era * 146097 + dayOfEra - 719468;
+}
+
+// Fixed-layout ISO-8601 "YYYY-MM-DDTHH:MM:SS[.fffffffff][Z]" (a space may replace the 'T'),
+// read as UTC. Done once at load so time-based work compares integers instead of strings.
+NumericParseResult parseTimestampView(string_view field, int64_t& epochNanos) {
+    epochNanos = TIMESTAMP_MISSING;
+    field = trimNumber(field);
+    if (field.empty() || isNullField(field)) return NUMERIC_NULL;
+
+    int year, month, day, hour, minute, second;
+    if (field.size() < 19 ||
+        !readDigits(field, 0, 4, year) || field[4] != '-' ||
+        !readDigits(field, 5, 2, month) || field[7] != '-' ||
+        !readDigits(field, 8, 2, day) || (field[10] != 'T' && field[10] != ' ') ||
+        !readDigits(field, 11, 2, hour) || field[13] != ':' ||
+        !readDigits(field, 14, 2, minute) || field[16] != ':' ||
+        !readDigits(field, 17, 2, second)) {
+        return NUMERIC_MALFORMED;
+    }
+
+    static const int daysInMonth[12] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month < 1 || month > 12 || day < 1 || day > daysInMonth[month - 1] ||
+        hour > 23 || minute > 59 || second > 60) {
+        return NUMERIC_MALFORMED;
+    }
+    bool leapYear = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    if (month == 2 && day == 29 && !leapYear) return NUMERIC_MALFORMED;
+
+    size_t pos = 19;
+    int64_t fraction = 0;
+    if (pos < field.size() && field[pos] == '.') {
+        pos++;
+        size_t digits = 0;
+        while (pos < field.size() && field[pos] >= '0' && field[pos] <= '9' && digits < 9) {
+            fraction = fraction * 10 + (field[pos] - '0');
+            pos++;
+            digits++;
+        }
+        if (digits == 0) return NUMERIC_MALFORMED;
+        for (; digits < 9; digits++) fraction *= 10;
+    }
+    if (pos < field.size() && field[pos] == 'Z') pos++;
+    if (pos != field.size()) return NUMERIC_MALFORMED;
+
+    int64_t seconds = daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    epochNanos = seconds * 1000000000LL + fraction;
+    return NUMERIC_OK;
+}
+
+static inline double parseDoubleField(string_view field, int column, ParseStats* stats) {
+    double value;
+    NumericParseResult result = parseDoubleView(field, value);
+    if (stats != nullptr) stats->record(column, result);
+    return value;
+}
+
+static inline int parseIntField(string_view field, int column, ParseStats* stats) {
+    int value;
+    NumericParseResult result = parseIntView(field, value);
+    if (stats != nullptr) stats->record(column, result);
+    return value;
+}
+
+static inline CategoryCode internCategory(CategoryColumn column, string_view field, const char* nullReplacement, CategoryInternCache* cache) {
+    if (isNullField(field)) {
+        field = nullReplacement;
+    }
+    return (cache != nullptr) ? cache->intern(column, field) : categoryTable.intern(column, field);
+}
+
+// Fills a Transaction straight from the field views of one CSV line.
+// Parallel loaders pass their own cache so repeated categories skip the table lock.
+void parseTransactionFields(string_view line, Transaction& trans, ParseStats* stats, CategoryInternCache* cache) {
+    string_view fields[TRANSACTION_FIELD_COUNT];
+    splitCSVFields(line, fields, TRANSACTION_FIELD_COUNT);
+
+    trans.transaction_id = encodePrefixedKey(fields[0], TRANSACTION_ID_PREFIX);
+    trans.timestamp.assign(fields[1].data(), fields[1].size());
+    // Empty timestamps are common in the data and are not numeric defaults, so only count bad ones
+    if (parseTimestampView(fields[1], trans.timestamp_ns) == NUMERIC_MALFORMED && stats != nullptr) {
+        stats->malformedCells[1]++;
+    }
+    trans.sender_account = encodePrefixedKey(fields[2], ACCOUNT_PREFIX);
+    trans.receiver_account = encodePrefixedKey(fields[3], ACCOUNT_PREFIX);
+    trans.amount = parseDoubleField(fields[4], 4, stats);
+
+    trans.transaction_type = internCategory(CATEGORY_TRANSACTION_TYPE, fields[5], "Unknown", cache);
+    trans.merchant_category = internCategory(CATEGORY_MERCHANT, fields[6], "Unknown", cache);
+    trans.location = internCategory(CATEGORY_LOCATION, fields[7], "Unknown", cache);
+    trans.device_used = internCategory(CATEGORY_DEVICE, fields[8], "Unknown", cache);
+
+    string_view fraudField = fields[9];
+    trans.is_fraud = (fraudField == "1" || fraudField == "true" || fraudField == "TRUE");
+
+    trans.fraud_type = internCategory(CATEGORY_FRAUD_TYPE, fields[10], "", cache);
+    trans.time_since_last_transaction = parseDoubleField(fields[11], 11, stats);
+    trans.spending_deviation_score = parseDoubleField(fields[12], 12, stats);
+    trans.velocity_score = parseIntField(fields[13], 13, stats);
+    trans.geo_anomaly_score = parseDoubleField(fields[14], 14, stats);
+
+    trans.payment_channel = internCategory(CATEGORY_PAYMENT_CHANNEL, fields[15], "Unknown", cache);
+    trans.ip_address = encodeIpAddress(isNullField(fields[16]) ? string_view() : fields[16]);
+    trans.device_hash = encodeDeviceHash(isNullField(fields[17]) ? string_view() : fields[17]);
+}
@@ -1,62 +1,35 @@
 #include "fileManager.h"
 
-void analyzeData(const string& filename)
-{
-    cout << "\n=== Data Analysis Process ===" << endl;
-    cout << "Analyzing dataset for missing values..." << endl;
-
-    ifstream file(filename);
-    if (!file.is_open())
-    {
-        cout << "Error: Cannot open file: " << filename << endl;
-        return;
-    }
-
-    string line;
-    int missingCounts[18] = {0};
-    string columnNames[18] =
-    {
-        "transaction_id", "timestamp", "sender_account", "receiver_account",
-        "amount", "transaction_type", "merchant_category", "location",
-        "device_used", "is_fraud", "fraud_type", "time_since_last_transaction",
-        "spending_deviation_score", "velocity_score", "geo_anomaly_score",
-        "payment_channel", "ip_address", "device_hash"
-    };
-
-    int totalRows = 0;
+// ============= MISSING VALUE ANALYSIS =============
 
-    // Skip header
-    getline(file, line);
+// Adds one row's missing fields (empty, blank or NULL) to the per-column counts
+void countMissingFields(string_view line, int missingCounts[])
+{
+    string_view fields[TRANSACTION_FIELD_COUNT];
+    int fieldCount = splitCSVFields(line, fields, TRANSACTION_FIELD_COUNT);
 
-    while (getline(file, line))
+    for (int i = 0; i < fieldCount; i++)
     {
-        stringstream ss(line);
-        string field;
-        int fieldIndex = 0;
-
-        while (getline(ss, field, ',') && fieldIndex < 18)
+        string_view field = fields[i];
+        if (field.empty() || field == " " || field == "NULL" || field == "null")
         {
-            if (field.empty() || field == " " || field == "NULL" || field == "null")
-            {
-                missingCounts[fieldIndex]++;
-            }
-            fieldIndex++;
+            missingCounts[i]++;
         }
-        totalRows++;
     }
+}
 
-    file.close();
-
+void displayMissingValueReport(const int missingCounts[], long long totalRows)
+{
     cout << "\n=== Missing Value Analysis Results ===" << endl;
     cout << "Total rows analyzed: " << totalRows << endl;
-    cout << setw(25) << "Column Name" << setw(15) << "Missing Count" << setw(15) << "Percentage" << endl;
+    cout << right << setw(25) << "Column Name" << setw(15) << "Missing Count" << setw(15) << "Percentage" << endl;
     cout << string(55, '-') << endl;
 
     bool hasMissingValues = false;
-    for (int i = 0; i < 18; i++)
+    for (int i = 0; i < TRANSACTION_FIELD_COUNT; i++)
     {
-        double percentage = (double)missingCounts[i] / totalRows * 100;
-        cout << setw(25) << columnNames[i]
+        double percentage = (totalRows > 0) ? (double)missingCounts[i] / totalRows * 100 : 0.0;
+        cout << setw(25) << TRANSACTION_COLUMN_NAMES[i]
              << setw(15) << missingCounts[i]
              << setw(14) << fixed << setprecision(2) << percentage << "%" << endl;
 
@@ -76,83 +49,86 @@ void analyzeData(const string& filename)
     }
 }
 
-void analyzePaymentChannels(const string& filename) {
-    cout << "Analysing transaction payment channels..." << endl;
-
-    ifstream file(filename);
-    if (!file.is_open()) {
-        cout << "Error: Cannot open file: " << filename << endl;
-        return;
-    }
-
-    string line;
-    getline(file, line); // Skip header
+// ============= PAYMENT CHANNEL ANALYSIS =============
 
-    // Array to store unique channel names (no STL containers)
-    const int MAX_CHANNELS = 50;
-    string uniqueChannels[MAX_CHANNELS];
-    int channelCounts[MAX_CHANNELS];
-    int uniqueChannelCount = 0;
-    int totalTransactions = 0;
-
-    while (getline(file, line)) {
-        if (line.empty()) continue;
-
-        // Extract payment channel field (field 16, index 15)
-        stringstream ss(line);
-        string field;
-        string paymentChannel = "";
-
-        // Skip to payment channel field
-        for (int i = 0; i <= 15; i++) {
-            if (getline(ss, field, ',')) {
-                if (i == 15) { // payment_channel field
-                    paymentChannel = field;
-                    if (paymentChannel == "Null" || paymentChannel == "NULL" || paymentChannel.empty()) {
-                        paymentChannel = "Unknown";
-                    }
-                    break;
-                }
-            }
-        }
+ChannelTally::ChannelTally()
+{
+    uniqueChannelCount = 0;
+    totalTransactions = 0;
+}
 
-        if (paymentChannel.empty()) {
-            paymentChannel = "Unknown";
-        }
+void ChannelTally::add(string_view paymentChannel)
+{
+    if (paymentChannel == "Null" || paymentChannel == "NULL" || paymentChannel.empty())
+    {
+        paymentChannel = "Unknown";
+    }
 
-        // Check if channel already exists
-        bool found = false;
-        for (int i = 0; i < uniqueChannelCount; i++) {
-            if (uniqueChannels[i] == paymentChannel) {
-                channelCounts[i]++;
-                found = true;
-                break;
-            }
-        }
+    totalTransactions++;
 
-        // Add new channel if not found
-        if (!found && uniqueChannelCount < MAX_CHANNELS) {
-            uniqueChannels[uniqueChannelCount] = paymentChannel;
-            channelCounts[uniqueChannelCount] = 1;
-            uniqueChannelCount++;
+    // Check if channel already exists
+    for (int i = 0; i < uniqueChannelCount; i++)
+    {
+        if (uniqueChannels[i] == paymentChannel)
+        {
+            channelCounts[i]++;
+            return;
         }
+    }
 
-        totalTransactions++;
+    // Add new channel if not found
+    if (uniqueChannelCount < MAX_TALLY_CHANNELS)
+    {
+        uniqueChannels[uniqueChannelCount].assign(paymentChannel.data(), paymentChannel.size());
+        channelCounts[uniqueChannelCount] = 1;
+        uniqueChannelCount++;
     }
+}
 
-    file.close();
+// Payment channel is field 16 (index 15)
+string_view extractPaymentChannel(string_view line)
+{
+    string_view fields[TRANSACTION_FIELD_COUNT];
+    splitCSVFields(line, fields, TRANSACTION_FIELD_COUNT);
+    return fields[15];
+}
 
+void displayChannelDistribution(const ChannelTally& tally)
+{
     cout << "\n=== Payment Channel Analysis Results ===" << endl;
-    cout << "Total transactions analyzed: " << totalTransactions << endl;
-    cout << "Unique payment channels found: " << uniqueChannelCount << endl;
+    cout << "Total transactions analyzed: " << tally.totalTransactions << endl;
+    cout << "Unique payment channels found: " << tally.uniqueChannelCount << endl;
     cout << "\nChannel Distribution:" << endl;
     cout << string(50, '-') << endl;
 
-    for (int i = 0; i < uniqueChannelCount; i++) {
-        double percentage = (double)channelCounts[i] / totalTransactions * 100;
-        cout << left << setw(20) << uniqueChannels[i]
-             << setw(10) << channelCounts[i]
+    for (int i = 0; i < tally.uniqueChannelCount; i++) {
+        double percentage = (double)tally.channelCounts[i] / tally.totalTransactions * 100;
+        cout << left << setw(20) << tally.uniqueChannels[i]
+             << setw(10) << tally.channelCounts[i]
              << setw(10) << fixed << setprecision(1) << percentage << "%" << endl;
     }
     cout << string(50, '-') << endl;
 }
+
+void analyzePaymentChannels(const string& filename) {
+    cout << "Analysing transaction payment channels..." << endl;
+
+    MappedFile input;
+    if (!input.open(filename)) {
+        cout << "Error: Cannot open file: " << filename << endl;
+        return;
+    }
+
+    CSVScanner scanner(input.data(), input.size());
+    string_view line;
+    scanner.nextLine(line); // Skip header
+
+    ChannelTally tally;
+
+    while (scanner.nextLine(line)) {
+        if (line.empty()) continue;
+        tally.add(extractPaymentChannel(line));
+    }
+
+    displayChannelDistribution(tally);
+}
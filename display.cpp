@@ -13,54 +13,57 @@ void displayMenu() {
     cout << "4. Search for Transaction Type" << endl;
     cout << "5. Store Full Reduced Dataset" << endl;
     cout << "6. Store Data by Payment Channel" << endl;
-    cout << "7. Exit" << endl;
+    cout << "7. Follow Live Transaction Feed" << endl;
+    cout << "8. Exit" << endl;
     cout << string(66, '=') << endl;
-    cout << "Enter choice (1-7): ";
+    cout << "Enter choice (1-8): ";
 }
 // ============= DATA STRUCTURE DISPLAYS =============
 
 void displayChannelSeparation(const ChannelArray& channelArrays) {
-    cout << "\n=== PAYMENT CHANNEL SEPARATION (ARRAY) ===" << endl;
+    cout << "\n=== " << partitionColumnLabel(channelArrays.getPartitionColumn()) << " SEPARATION ===" << endl;
 
     for (int i = 0; i < channelArrays.getChannelCount(); i++) {
         cout << channelArrays.getChannelName(i) << ": " << channelArrays.getChannel(i).getSize() << " transactions" << endl;
     }
 }
 
-void displayChannelSeparationLL(const ChannelListArray& channelLists) {
-    cout << "\n=== PAYMENT CHANNEL SEPARATION (LINKED LIST) ===" << endl;
+// ============= PERFORMANCE DISPLAYS =============
 
-    for (int i = 0; i < channelLists.getChannelCount(); i++) {
-        cout << channelLists.getChannelName(i) << ": " << channelLists.getChannel(i).getSize() << " transactions" << endl;
+void displayParseStats(const ParseStats& stats) {
+    cout << "Null numeric cells (defaulted to 0): " << stats.nullNumericCells << endl;
+    if (stats.storeFullRows > 0) {
+        cout << "Error: store full (32-bit row indices), rows rejected: " << stats.storeFullRows << endl;
     }
-}
 
-// ============= PERFORMANCE DISPLAYS =============
+    int malformed = stats.totalMalformed();
+    if (malformed == 0) return;
 
-void displayLoadingSeparationPerformance(int arrayTime, int listTime, int totalArrayTransactions, int totalListTransactions) {
+    cout << "Malformed numeric cells: " << malformed << endl;
+    for (int i = 0; i < TRANSACTION_FIELD_COUNT; i++) {
+        if (stats.malformedCells[i] > 0) {
+            cout << "  " << left << setw(30) << TRANSACTION_COLUMN_NAMES[i] << stats.malformedCells[i] << endl;
+        }
+    }
+}
+
+// Resident bytes are the whole live heap, so they show what a session really holds
+void displayLoadPerformance(int loadTime, long long totalTransactions, size_t residentBytes) {
     cout << "\n" << string(66, '=') << endl;
-    cout << "              LOAD + SEPARATION PERFORMANCE COMPARISON" << endl;
+    cout << "                 LOAD + SEPARATION PERFORMANCE" << endl;
     cout << string(66, '=') << endl;
-    cout << left << setw(20) << "Data Structure"
-         << setw(15) << "Time (ms)"
+    cout << left << setw(20) << "Time (ms)"
          << setw(15) << "Transactions"
-         << setw(15) << "Speed (trans/s)" << endl;
+         << setw(17) << "Speed (trans/s)"
+         << setw(14) << "Resident (MB)" << endl;
     cout << string(66, '-') << endl;
 
-    cout << left << setw(20) << "Dynamic Array"
-         << setw(15) << arrayTime
-         << setw(15) << totalArrayTransactions
-         << setw(15) << (arrayTime > 0 ? (totalArrayTransactions * 1000) / arrayTime : 0) << endl;
-
-    cout << left << setw(20) << "Linked List"
-         << setw(15) << listTime
-         << setw(15) << totalListTransactions
-         << setw(15) << (listTime > 0 ? (totalListTransactions * 1000) / listTime : 0) << endl;
-
+    cout << left << setw(20) << loadTime
+         << setw(15) << totalTransactions
+         << setw(17) << (loadTime > 0 ? (totalTransactions * 1000) / loadTime : 0)
+         << setw(14) << fixed << setprecision(1) << residentBytes / (1024.0 * 1024.0) << endl;
     cout << string(66, '-') << endl;
-    cout << "DIFFERENCES:" << endl;
-    cout << "Time difference: " << absInt(arrayTime - listTime) << " ms" << endl;
-    cout << "Speed difference: " << absInt((totalArrayTransactions * 1000) / arrayTime - (totalListTransactions * 1000) / listTime) << " trans/s" << endl;
+    cout << "One master store; channels are 32-bit row index partitions over it" << endl;
 }
 
 // ============= SEARCH INTERFACE DISPLAYS =============
@@ -87,9 +90,9 @@ void getValidTransactionTypes(const ChannelArray& channelArrays, string validTyp
     validTypeCount = 0;
 
     for (int i = 0; i < channelArrays.getChannelCount(); i++) {
-        const DynamicArray& channel = channelArrays.getChannel(i);
-        for (int j = 0; j < channel.getSize() && j < 100; j++) {
-            string currentType = channel[j].transaction_type;
+        ChannelView channel = channelArrays.getChannel(i);
+        for (size_t j = 0; j < channel.getSize() && j < 100; j++) {
+            string currentType = categoryName(CATEGORY_TRANSACTION_TYPE, channel[j].transaction_type);
 
             // Check if already exists
             bool exists = false;
@@ -5,8 +5,19 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <cstring>
+#include <cstdint>
+#include <charconv>
 #include <chrono>
 #include <iomanip>
+#include <thread>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <limits>
+#include <stdexcept>
 
 using namespace std;
 using namespace std::chrono;
@@ -16,31 +27,114 @@ inline int minInt(int a, int b) { return (a < b) ? a : b; }
 inline int maxInt(int a, int b) { return (a > b) ? a : b; }
 inline double absDouble(double x) { return (x < 0) ? -x : x; }
 inline int absInt(int x) { return (x < 0) ? -x : x; }
+inline long long absLongLong(long long x) { return (x < 0) ? -x : x; }
+inline size_t minSize(size_t a, size_t b) { return (a < b) ? a : b; }
 
 // ============= DATA STRUCTURES =============
 
+// Low-cardinality text columns, held in Transaction as codes into categoryTable
+enum CategoryColumn {
+    CATEGORY_TRANSACTION_TYPE,
+    CATEGORY_MERCHANT,
+    CATEGORY_LOCATION,
+    CATEGORY_DEVICE,
+    CATEGORY_FRAUD_TYPE,
+    CATEGORY_PAYMENT_CHANNEL,
+    CATEGORY_COLUMN_COUNT
+};
+
+typedef uint32_t CategoryCode;
+
+const CategoryCode CATEGORY_EMPTY_CODE = 0;    // "" in every column
+
+// Identifier columns held in compact binary form (see COMPACT KEYS below)
+
+// "T100000" / "ACC595185": the digits after the known prefix, as a number.
+// With the top bit set, the low bits index fallbackStrings instead (empty, "Null", odd formats).
+typedef uint64_t PrefixedKey;
+
+const PrefixedKey PREFIXED_KEY_FALLBACK = (uint64_t)1 << 63;
+const PrefixedKey PREFIXED_KEY_EMPTY = PREFIXED_KEY_FALLBACK;    // fallback 0 is ""
+
+const char* const TRANSACTION_ID_PREFIX = "T";
+const char* const ACCOUNT_PREFIX = "ACC";
+
+// Dotted-quad IPv4 packed into 32 bits; anything else is kept in fallbackStrings
+const uint32_t IP_ADDRESS_NUMERIC = 0xFFFFFFFF;
+
+struct IpAddress {
+    uint32_t address;   // a.b.c.d as (a << 24) | (b << 16) | (c << 8) | d
+    uint32_t fallback;  // IP_ADDRESS_NUMERIC, or an index into fallbackStrings
+
+    IpAddress() : address(0), fallback(0) {}
+};
+
+// Up to 16 bytes held inline and zero padded; a first byte of 0xFF marks a
+// longer value whose fallbackStrings index is in words[1]
+const int DEVICE_HASH_INLINE_BYTES = 16;
+const unsigned char DEVICE_HASH_FALLBACK_MARK = 0xFF;
+
+struct DeviceHash {
+    uint64_t words[2];
+
+    DeviceHash() : words{0, 0} {}
+};
+
+// Epoch nanoseconds (UTC) for an empty or unparseable timestamp
+const int64_t TIMESTAMP_MISSING = INT64_MIN;
+
 struct Transaction {
-    string transaction_id;
+    PrefixedKey transaction_id;
     string timestamp;
-    string sender_account;
-    string receiver_account;
+    int64_t timestamp_ns;       // timestamp parsed once at load, or TIMESTAMP_MISSING
+    PrefixedKey sender_account;
+    PrefixedKey receiver_account;
     double amount;
-    string transaction_type;
-    string merchant_category;
-    string location;
-    string device_used;
+    CategoryCode transaction_type;
+    CategoryCode merchant_category;
+    CategoryCode location;
+    CategoryCode device_used;
     bool is_fraud;
-    string fraud_type;
+    CategoryCode fraud_type;
     double time_since_last_transaction;
     double spending_deviation_score;
     int velocity_score;
     double geo_anomaly_score;
-    string payment_channel;
-    string ip_address;
-    string device_hash;
+    CategoryCode payment_channel;
+    IpAddress ip_address;
+    DeviceHash device_hash;
 
-    Transaction() : amount(0.0), is_fraud(false), time_since_last_transaction(0.0),
-                   spending_deviation_score(0.0), velocity_score(0), geo_anomaly_score(0.0) {}
+    Transaction() : transaction_id(PREFIXED_KEY_EMPTY), timestamp_ns(TIMESTAMP_MISSING), sender_account(PREFIXED_KEY_EMPTY),
+                   receiver_account(PREFIXED_KEY_EMPTY), amount(0.0), transaction_type(CATEGORY_EMPTY_CODE), merchant_category(CATEGORY_EMPTY_CODE),
+                   location(CATEGORY_EMPTY_CODE), device_used(CATEGORY_EMPTY_CODE), is_fraud(false),
+                   fraud_type(CATEGORY_EMPTY_CODE), time_since_last_transaction(0.0),
+                   spending_deviation_score(0.0), velocity_score(0), geo_anomaly_score(0.0),
+                   payment_channel(CATEGORY_EMPTY_CODE) {}
+};
+
+// Hot half of a record: the fixed-size fields that sorting, searching and scoring
+// read. cold is the position of the full record in the container the hot records
+// were built from, so algorithms shuffle these 48-byte records and the full
+// (cold) records are moved once at the end.
+struct HotTransaction {
+    double amount;
+    double spending_deviation_score;
+    double geo_anomaly_score;
+    CategoryCode location;
+    CategoryCode transaction_type;
+    int velocity_score;
+    uint32_t cold;
+    bool is_fraud;
+
+    HotTransaction() : amount(0.0), spending_deviation_score(0.0), geo_anomaly_score(0.0),
+                       location(CATEGORY_EMPTY_CODE), transaction_type(CATEGORY_EMPTY_CODE),
+                       velocity_score(0), cold(0), is_fraud(false) {}
+
+    HotTransaction(const Transaction& trans, uint32_t coldIndex)
+        : amount(trans.amount), spending_deviation_score(trans.spending_deviation_score),
+          geo_anomaly_score(trans.geo_anomaly_score), location(trans.location),
+          transaction_type(trans.transaction_type), velocity_score(trans.velocity_score),
+          cold(coldIndex), is_fraud(trans.is_fraud) {}
 };
 
 struct ListNode {
@@ -52,94 +146,624 @@ struct ListNode {
 
 struct PerformanceMetrics {
     double time_taken;
-    size_t memory_used;
+    size_t memory_used;         // measured container bytes plus the algorithm's measured peak
+    size_t allocation_count;    // heap allocations made by the algorithm
     string algorithm_name;
     string data_structure;
 
-    PerformanceMetrics() : time_taken(0.0), memory_used(0) {}
+    PerformanceMetrics() : time_taken(0.0), memory_used(0), allocation_count(0) {}
+};
+
+// ============= STRING DICTIONARY =============
+
+uint64_t hashString(string_view value);
+
+const int STRING_DICTIONARY_BLOCKS = 32;
+
+// Maps each distinct string to a dense code (0, 1, 2, ...) in order of first sight.
+// Entries live in blocks of 16, 32, 64, ... strings and never move once added,
+// so a reference returned by lookup stays valid while the dictionary grows.
+class StringDictionary {
+private:
+    string* blocks[STRING_DICTIONARY_BLOCKS];
+    int entryCount;
+    int* slots;         // open addressing, -1 = empty, holds codes
+    int slotCount;      // always a power of two
+
+    string& entryAt(int code) const;
+    void rehash();
+
+public:
+    StringDictionary();
+    ~StringDictionary();
+    StringDictionary(const StringDictionary&) = delete;
+    StringDictionary& operator=(const StringDictionary&) = delete;
+
+    int intern(string_view value);
+    int find(string_view value) const;
+    const string& lookup(int code) const;
+    int size() const;
+    void clear();
 };
 
 // ============= CLASSES =============
 
+const int TRANSACTION_FIELD_COUNT = 18;
+
+enum LoadMode {
+    LOAD_BUFFERED,  // read the whole file into memory with ifstream
+    LOAD_MAPPED     // parse directly from memory-mapped pages
+};
+
+class MappedFile {
+private:
+    const char* mappedData;
+    size_t mappedSize;
+    bool mapped;
+    string buffer;
+
+    bool mapFile(const string& filename);
+
+public:
+    MappedFile();
+    ~MappedFile();
+    bool open(const string& filename, LoadMode mode = LOAD_MAPPED);
+    void close();
+    const char* data() const;
+    size_t size() const;
+    bool isMapped() const;
+};
+
+// Bitmasks over one 32-byte block: bit i is set when byte i is the delimiter
+const int DELIMITER_BLOCK_SIZE = 32;
+
+struct DelimiterMasks {
+    uint32_t commas;
+    uint32_t newlines;
+    uint32_t quotes;
+
+    DelimiterMasks() : commas(0), newlines(0), quotes(0) {}
+};
+
+class CSVScanner {
+private:
+    const char* cursor;
+    const char* end;
+
+public:
+    CSVScanner(const char* data, size_t length);
+    bool nextLine(string_view& line);
+    bool atEnd() const;
+    const char* position() const;
+};
+
+enum NumericParseResult {
+    NUMERIC_OK,
+    NUMERIC_NULL,       // empty or "Null" cell, value defaults to 0
+    NUMERIC_MALFORMED   // not a number (or trailing garbage)
+};
+
+extern const char* const TRANSACTION_COLUMN_NAMES[TRANSACTION_FIELD_COUNT];
+
+// Per-load counters for numeric cells that were missing or could not be parsed
+struct ParseStats {
+    int nullNumericCells;
+    int malformedCells[TRANSACTION_FIELD_COUNT];
+    long long storeFullRows;    // rows rejected because the master store ran out of row indices
+
+    ParseStats();
+    void record(int column, NumericParseResult result);
+    void merge(const ParseStats& other);
+    int totalMalformed() const;
+};
+
+struct CSVChunk {
+    const char* begin;
+    const char* end;
+
+    CSVChunk() : begin(nullptr), end(nullptr) {}
+};
+
+// Records live in fixed-size segments, so growing never copies existing records
+const int TRANSACTION_SEGMENT_SHIFT = 10;
+const size_t TRANSACTION_SEGMENT_SIZE = (size_t)1 << TRANSACTION_SEGMENT_SHIFT;    // 1024 records
+
 class DynamicArray {
 private:
-    Transaction* arr;
-    int capacity;
-    int size;
+    Transaction** segments;     // directory of raw segments; only the first size slots hold records
+    size_t segmentCount;
+    size_t directoryCapacity;
+    size_t size;
+
+    void addSegment();
+    void destroyRecords();
+
+    void* nextSlot();
 
 public:
     DynamicArray();
     ~DynamicArray();
-    void resize();
+    DynamicArray(const DynamicArray&) = delete;
+    DynamicArray& operator=(const DynamicArray&) = delete;
+    DynamicArray(DynamicArray&& other) noexcept;                // takes the segments, other is left empty
+    DynamicArray& operator=(DynamicArray&& other) noexcept;
+
     void push_back(const Transaction& trans);
+    void push_back(Transaction&& trans);
+
+    // Constructs the record directly in the next slot and returns it
+    template <typename... Args>
+    Transaction& emplace_back(Args&&... args) {
+        Transaction* record = new (nextSlot()) Transaction(std::forward<Args>(args)...);
+        size++;
+        return *record;
+    }
+
+    void append(DynamicArray& other);   // moves other's records to the end, other is left empty
+    void reserve(size_t count);
+    void shrink_to_fit();               // frees segments past the last record and the spare directory
     void clear();
-    Transaction& operator[](int index);
-    const Transaction& operator[](int index) const;
-    int getSize() const;
+    Transaction& operator[](size_t index);
+    const Transaction& operator[](size_t index) const;
+    size_t getSize() const;
+    size_t getCapacity() const;
+};
+
+// ListNodes are carved out of slabs in insertion order, so list traversal walks
+// memory mostly front to back and a whole list is released slab by slab
+const int LIST_NODE_SLAB_SIZE = 256;
+
+struct NodeSlab {
+    NodeSlab* next;
+    int used;
+    alignas(ListNode) unsigned char storage[sizeof(ListNode) * LIST_NODE_SLAB_SIZE];
+
+    ListNode* node(int index) { return reinterpret_cast<ListNode*>(storage) + index; }
+};
+
+class ListNodePool {
+private:
+    NodeSlab* current;  // slab being filled
+    NodeSlab* filled;   // full slabs holding live nodes
+    NodeSlab* spare;    // emptied slabs kept for reuse
+
+    static void destroyNodes(NodeSlab* slab);
+    static void freeChain(NodeSlab* chain);
+
+public:
+    ListNodePool();
+    ~ListNodePool();
+    ListNodePool(const ListNodePool&) = delete;
+    ListNodePool& operator=(const ListNodePool&) = delete;
+
+    ListNode* allocate(const Transaction& trans);
+    void reset();                       // destroys all nodes, keeps the slabs
+    size_t getSlabCount() const;
 };
 
 class SinglyLinkedList {
 private:
     ListNode* head;
     ListNode* tail;
-    int size;
+    size_t size;
+    ListNodePool pool;
 
 public:
     SinglyLinkedList();
     ~SinglyLinkedList();
     void push_back(const Transaction& trans);
+    void append(SinglyLinkedList& other);
     void clear();
-    int getSize() const;
+    size_t getSize() const;
     ListNode* getHead() const;
-    void setHead(ListNode* newHead);
+    void setHead(ListNode* newHead);    // newHead must be a node of this list
+};
+
+// Rows of a master store are addressed by 32-bit indices, a quarter of a
+// pointer-sized reference and a small fraction of a Transaction copy
+typedef uint32_t RowIndex;
+
+// A store holding more rows than this cannot address them; add/append throw length_error
+const size_t MAX_STORE_ROWS = (size_t)numeric_limits<RowIndex>::max() + 1;
+
+class IndexVector {
+private:
+    RowIndex* rows;
+    size_t size;
+    size_t capacity;
+
+public:
+    IndexVector();
+    ~IndexVector();
+    IndexVector(const IndexVector&) = delete;
+    IndexVector& operator=(const IndexVector&) = delete;
+
+    void push_back(RowIndex row);
+    void reserve(size_t count);
+    void clear();
+    RowIndex& operator[](size_t index) { return rows[index]; }
+    RowIndex operator[](size_t index) const { return rows[index]; }
+    RowIndex* data() { return rows; }
+    const RowIndex* data() const { return rows; }
+    size_t getSize() const;
+};
+
+// Read-only view of the master rows listed in an IndexVector
+class ChannelView {
+private:
+    const DynamicArray* records;
+    const IndexVector* rows;
+
+public:
+    ChannelView(const DynamicArray& masterRecords, const IndexVector& rowIndices)
+        : records(&masterRecords), rows(&rowIndices) {}
+
+    const Transaction& operator[](size_t index) const { return (*records)[(*rows)[index]]; }
+    size_t getSize() const { return rows->getSize(); }
+    const IndexVector& getRows() const { return *rows; }
+    const DynamicArray& getRecords() const { return *records; }
+};
+
+// Partition name -> partition index, plus a direct table from the category code of
+// the partitioned column to the same index. Both lookups are O(1) and neither has a
+// cap; indices follow first sight, so partitions keep the order rows introduced them.
+class PartitionMap {
+private:
+    StringDictionary names;     // code = partition index
+    int* partitionForCode;      // by CategoryCode, -1 = not bound yet
+    int codeCapacity;
+
+public:
+    PartitionMap();
+    ~PartitionMap();
+    PartitionMap(const PartitionMap&) = delete;
+    PartitionMap& operator=(const PartitionMap&) = delete;
+
+    int add(string_view name);              // index of name, added if new
+    int find(string_view name) const;       // -1 if absent
+    void bindCode(CategoryCode code, int partition);
+    int findCode(CategoryCode code) const {
+        return (code < (CategoryCode)codeCapacity) ? partitionForCode[code] : -1;
+    }
+    const string& name(int partition) const;
+    int size() const;
+    void clear();
 };
 
+// Grows a table of owned partition pointers to hold at least count entries
+template <typename T>
+void growPartitionSlots(T**& slots, int& capacity, int count) {
+    if (count <= capacity) return;
+
+    int newCapacity = (capacity == 0) ? 8 : capacity;
+    while (newCapacity < count) newCapacity *= 2;
+
+    T** grown = new T*[newCapacity];
+    for (int i = 0; i < capacity; i++) grown[i] = slots[i];
+    for (int i = capacity; i < newCapacity; i++) grown[i] = nullptr;
+    delete[] slots;
+    slots = grown;
+    capacity = newCapacity;
+}
+
+// One master store holding every loaded row once, in load order, with each
+// value of the partition column (payment_channel by default) kept as a
+// partition of row indices over it
 class ChannelArray {
 private:
-    DynamicArray* channels;
-    string* channelNames;
-    int channelCount;
-    int maxChannels;
+    DynamicArray records;
+    IndexVector** channels;
+    int slotCapacity;
+    PartitionMap partitionMap;
+    CategoryColumn partitionColumn;
 
 public:
-    ChannelArray();
+    ChannelArray(CategoryColumn column = CATEGORY_PAYMENT_CHANNEL);
     ~ChannelArray();
+    ChannelArray(const ChannelArray&) = delete;
+    ChannelArray& operator=(const ChannelArray&) = delete;
+
     void addChannel(const string& name);
     int findChannel(const string& name) const;
-    DynamicArray& getChannel(int index);
-    const DynamicArray& getChannel(int index) const;
+    int partitionFor(const Transaction& trans);     // index for trans's partition, created on first sight
+    void setPartitionColumn(CategoryColumn column); // empties the store
+    CategoryColumn getPartitionColumn() const;
+    void add(int channelIndex, const Transaction& trans);
+    void add(int channelIndex, Transaction&& trans);
+    void append(ChannelArray& other);   // moves other's rows and channels in, other is left empty
+    ChannelView getChannel(int index) const;
+    const DynamicArray& getRecords() const;
+    size_t getSize() const;
     string getChannelName(int index) const;
     int getChannelCount() const;
+    void clear();
 };
 
-class ChannelListArray {
+// Each node holds up to UNROLLED_NODE_CAPACITY records side by side, so a walk
+// follows one pointer per block instead of one per record
+const int UNROLLED_NODE_CAPACITY = 16;
+
+// Slots are raw storage; only the first count hold constructed records
+struct UnrolledNode {
+    int count;
+    UnrolledNode* next;
+    alignas(Transaction) unsigned char storage[sizeof(Transaction) * UNROLLED_NODE_CAPACITY];
+
+    UnrolledNode() : count(0), next(nullptr) {}
+    Transaction& item(int index) { return reinterpret_cast<Transaction*>(storage)[index]; }
+    const Transaction& item(int index) const { return reinterpret_cast<const Transaction*>(storage)[index]; }
+};
+
+class UnrolledLinkedList {
 private:
-    SinglyLinkedList* channels;
-    string* channelNames;
-    int channelCount;
-    int maxChannels;
+    UnrolledNode* head;
+    UnrolledNode* tail;
+    size_t size;
+    size_t nodeCount;
+
+    void* nextSlot();
 
 public:
-    ChannelListArray();
-    ~ChannelListArray();
-    void addChannel(const string& name);
-    int findChannel(const string& name) const;
-    SinglyLinkedList& getChannel(int index);
-    const SinglyLinkedList& getChannel(int index) const;
-    string getChannelName(int index) const;
-    int getChannelCount() const;
+    UnrolledLinkedList();
+    ~UnrolledLinkedList();
+    UnrolledLinkedList(const UnrolledLinkedList&) = delete;
+    UnrolledLinkedList& operator=(const UnrolledLinkedList&) = delete;
+
+    void push_back(const Transaction& trans);
+    void push_back(Transaction&& trans);
+    void clear();
+    size_t getSize() const;
+    size_t getNodeCount() const;
+    UnrolledNode* getHead() const;
+};
+
+// Linked-list variant the comparison harness measures against the array
+enum ListVariant {
+    LIST_SINGLY,    // SinglyLinkedList, one record per node
+    LIST_UNROLLED   // UnrolledLinkedList, blocks of UNROLLED_NODE_CAPACITY records
+};
+
+// ============= CATEGORY INTERN TABLE =============
+
+// One dictionary per categorical column, shared by every store for the whole run.
+// Codes follow first sight; rank() gives the case-insensitive sort position so
+// comparisons on these columns are integer compares.
+class CategoryTable {
+private:
+    StringDictionary dictionaries[CATEGORY_COLUMN_COUNT];
+    uint32_t* ranks[CATEGORY_COLUMN_COUNT];
+    bool ranksStale[CATEGORY_COLUMN_COUNT];
+    mutable mutex internLock;
+
+    void refreshRanks(CategoryColumn column);
+
+public:
+    CategoryTable();
+    ~CategoryTable();
+
+    CategoryCode intern(CategoryColumn column, string_view value);  // thread-safe
+    int find(CategoryColumn column, string_view value) const;       // -1 if never seen
+    int size(CategoryColumn column) const;
+
+    // Safe from any thread for a code it was handed
+    const string& name(CategoryColumn column, CategoryCode code) const {
+        return dictionaries[column].lookup((int)code);
+    }
+
+    // Not for use while another thread is interning
+    uint32_t rank(CategoryColumn column, CategoryCode code) {
+        if (ranksStale[column]) refreshRanks(column);
+        return ranks[column][code];
+    }
+};
+
+extern CategoryTable categoryTable;
+
+inline const string& categoryName(CategoryColumn column, CategoryCode code) {
+    return categoryTable.name(column, code);
+}
+
+inline CategoryCode categoryCodeOf(const Transaction& trans, CategoryColumn column) {
+    switch (column) {
+        case CATEGORY_TRANSACTION_TYPE: return trans.transaction_type;
+        case CATEGORY_MERCHANT: return trans.merchant_category;
+        case CATEGORY_LOCATION: return trans.location;
+        case CATEGORY_DEVICE: return trans.device_used;
+        case CATEGORY_FRAUD_TYPE: return trans.fraud_type;
+        default: return trans.payment_channel;
+    }
+}
+
+// Partition name for a category value; rows with an empty value go to "Unknown"
+string partitionNameFor(CategoryColumn column, CategoryCode code);
+
+// Per-thread front for categoryTable: values already seen by this thread
+// resolve without taking the table lock
+class CategoryInternCache {
+private:
+    StringDictionary seen[CATEGORY_COLUMN_COUNT];
+    CategoryCode* globalCodes[CATEGORY_COLUMN_COUNT];
+    int capacity[CATEGORY_COLUMN_COUNT];
+
+public:
+    CategoryInternCache();
+    ~CategoryInternCache();
+    CategoryInternCache(const CategoryInternCache&) = delete;
+    CategoryInternCache& operator=(const CategoryInternCache&) = delete;
+
+    CategoryCode intern(CategoryColumn column, string_view value);
+};
+
+// ============= COMPACT KEYS =============
+
+// Text of identifier values that have no compact form, shared by the whole run
+class FallbackStringTable {
+private:
+    StringDictionary dictionary;
+    mutable mutex internLock;
+
+public:
+    FallbackStringTable();
+    uint32_t intern(string_view value);     // thread-safe
+
+    const string& lookup(uint32_t index) const {
+        return dictionary.lookup((int)index);
+    }
+};
+
+extern FallbackStringTable fallbackStrings;
+
+PrefixedKey encodePrefixedKey(string_view value, const char* prefix);
+void appendPrefixedKey(string& out, PrefixedKey key, const char* prefix);
+string formatPrefixedKey(PrefixedKey key, const char* prefix);
+bool isMissingPrefixedKey(PrefixedKey key);     // "" or "Null"
+
+IpAddress encodeIpAddress(string_view value);
+void appendIpAddress(string& out, IpAddress ip);
+string formatIpAddress(IpAddress ip);
+
+DeviceHash encodeDeviceHash(string_view value);
+void appendDeviceHash(string& out, const DeviceHash& hash);
+string formatDeviceHash(const DeviceHash& hash);
+
+// ============= COLUMNAR TRANSACTION STORE =============
+
+class TransactionStore;
+
+// Read-only view of one row of a TransactionStore; fields are read straight from the columns
+class TransactionRow {
+private:
+    const TransactionStore* store;
+    size_t index;
+
+public:
+    TransactionRow(const TransactionStore* store, size_t index) : store(store), index(index) {}
+
+    PrefixedKey transaction_id() const;
+    const string& timestamp() const;
+    int64_t timestamp_ns() const;
+    PrefixedKey sender_account() const;
+    PrefixedKey receiver_account() const;
+    double amount() const;
+    CategoryCode transaction_type() const;
+    CategoryCode merchant_category() const;
+    CategoryCode location() const;
+    CategoryCode device_used() const;
+    bool is_fraud() const;
+    CategoryCode fraud_type() const;
+    double time_since_last_transaction() const;
+    double spending_deviation_score() const;
+    int velocity_score() const;
+    double geo_anomaly_score() const;
+    CategoryCode payment_channel() const;
+    IpAddress ip_address() const;
+    const DeviceHash& device_hash() const;
+
+    Transaction toTransaction() const;
+};
+
+// Structure-of-arrays alternative to DynamicArray: one contiguous array per field,
+// so a scan over amount or velocity_score only touches that column
+class TransactionStore {
+private:
+    PrefixedKey* transactionIds;
+    string* timestamps;
+    int64_t* timestampNs;
+    PrefixedKey* senderAccounts;
+    PrefixedKey* receiverAccounts;
+    double* amounts;
+    CategoryCode* transactionTypes;
+    CategoryCode* merchantCategories;
+    CategoryCode* locations;
+    CategoryCode* devicesUsed;
+    bool* fraudFlags;
+    CategoryCode* fraudTypes;
+    double* timesSinceLast;
+    double* spendingDeviationScores;
+    int* velocityScores;
+    double* geoAnomalyScores;
+    CategoryCode* paymentChannels;
+    IpAddress* ipAddresses;
+    DeviceHash* deviceHashes;
+    size_t size;
+    size_t capacity;
+
+    void grow();
+    void releaseColumns();
+
+    friend class TransactionRow;
+
+public:
+    TransactionStore();
+    ~TransactionStore();
+    TransactionStore(const TransactionStore&) = delete;
+    TransactionStore& operator=(const TransactionStore&) = delete;
+
+    void push_back(const Transaction& trans);
+    void append(const ChannelView& rows);
+    void clear();
+    TransactionRow row(size_t index) const;
+    Transaction get(size_t index) const;
+    size_t getSize() const;
+    size_t getCapacity() const;
+
+    // Reorders every column so that new row i is old row order[i]
+    void permute(const RowIndex* order);
+
+    const CategoryCode* transactionTypeColumn() const { return transactionTypes; }
+    const CategoryCode* locationColumn() const { return locations; }
 };
 
 // ============= CORE FUNCTIONS =============
 
 // CSV Processing
-bool reduceCSV(const string& inputFile, const string& outputFile, int targetRows);
-void analyzeData(const string& filename);
+enum SamplingMode {
+    SAMPLE_STRIDE,      // evenly spaced rows in file order
+    SAMPLE_RESERVOIR,   // uniform random rows, written in file order
+    SAMPLE_ALL          // every valid row, no reduction (targetRows is ignored)
+};
+
+const unsigned int RESERVOIR_SAMPLING_SEED = 20240501;
+
+const int MAX_TALLY_CHANNELS = 50;
+
+// Running count of transactions per payment channel
+struct ChannelTally {
+    string uniqueChannels[MAX_TALLY_CHANNELS];
+    int channelCounts[MAX_TALLY_CHANNELS];
+    int uniqueChannelCount;
+    int totalTransactions;
+
+    ChannelTally();
+    void add(string_view paymentChannel);
+};
+
+bool sampleCSVLines(const string& inputFile, long long targetRows, SamplingMode mode,
+                    string& headerLine, string*& sample, long long& sampledRows, long long& totalValidLines);
+void countMissingFields(string_view line, int missingCounts[]);
+void displayMissingValueReport(const int missingCounts[], long long totalRows);
+string_view extractPaymentChannel(string_view line);
+void displayChannelDistribution(const ChannelTally& tally);
 void analyzePaymentChannels(const string& filename);
 
+// SIMD Delimiter Scanning (AVX2 / SSE4.2 / scalar, picked at runtime)
+DelimiterMasks scanDelimiters(const char* data, size_t length);
+const char* findNewline(const char* data, const char* end);
+const char* getDelimiterKernelName();
+int countTrailingZeros(uint32_t mask);
+
+// CSV Parsing
+bool readFileToBuffer(const string& filename, string& buffer);
+int splitCSVFields(string_view line, string_view fields[], int maxFields);
+NumericParseResult parseDoubleView(string_view field, double& value);
+NumericParseResult parseIntView(string_view field, int& value);
+NumericParseResult parseTimestampView(string_view field, int64_t& epochNanos);
+void parseTransactionFields(string_view line, Transaction& trans, ParseStats* stats = nullptr, CategoryInternCache* cache = nullptr);
+int getLoaderThreadCount(size_t dataSize);
+int splitIntoLineChunks(const char* data, size_t length, int maxChunks, CSVChunk chunks[]);
+
 // Data Loading
-void loadAndSeparateArray(const string& filename, ChannelArray& channelArrays);
-void loadAndSeparateLinkedList(const string& filename, ChannelListArray& channelLists);
+void loadAndSeparateArray(const string& filename, ChannelArray& channelArrays, LoadMode mode = LOAD_MAPPED);
 
 // ============= SORTING ALGORITHMS =============
 
@@ -151,20 +775,310 @@ void quickSort(DynamicArray& arr);
 void quickSortLL(SinglyLinkedList& list);
 void heapSort(DynamicArray& arr);
 void heapSortLL(SinglyLinkedList& list);
+void mergeSortLLSafe(UnrolledLinkedList& list);
+void mergeSortLLSafeByTransactionType(UnrolledLinkedList& list);
+void quickSortLL(UnrolledLinkedList& list);
+void heapSortLL(UnrolledLinkedList& list);
+
+// Non-comparison sorts: counting sort on category ranks, MSD radix sort on the
+// case-folded location text
+void countingSort(DynamicArray& arr);
+void countingSortByTransactionType(DynamicArray& arr);
+void countingSortLL(SinglyLinkedList& list);
+void countingSortLL(UnrolledLinkedList& list);
+void radixSort(DynamicArray& arr);
+void radixSortLL(SinglyLinkedList& list);
+void radixSortLL(UnrolledLinkedList& list);
+
+// Parallel merge sort: per-thread block sorts, then merge-path merges that keep every
+// core busy in every round; stable, same order as mergeSortIterative
+void parallelMergeSort(DynamicArray& arr);
+void parallelMergeSortByTransactionType(DynamicArray& arr);
+void parallelMergeSortLL(SinglyLinkedList& list);
+void parallelMergeSortLL(UnrolledLinkedList& list);
+
+// Columnar store: sort a (key, row) pair per record, then gather each column once
+void mergeSortIterative(TransactionStore& store);
+void mergeSortIterativeByTransactionType(TransactionStore& store);
+void quickSort(TransactionStore& store);
+void heapSort(TransactionStore& store);
+void countingSort(TransactionStore& store);
+void radixSort(TransactionStore& store);
+void parallelMergeSort(TransactionStore& store);
+void parallelMergeSortByTransactionType(TransactionStore& store);
+
+// Row indices: order a view's 32-bit rows by a precomputed key array, leaving the
+// records in place; gatherRows is the optional pass that copies them out in order
+void mergeSortRows(const ChannelView& view, IndexVector& sortedRows);
+void mergeSortRowsByTransactionType(const ChannelView& view, IndexVector& sortedRows);
+void quickSortRows(const ChannelView& view, IndexVector& sortedRows);
+void heapSortRows(const ChannelView& view, IndexVector& sortedRows);
+void countingSortRows(const ChannelView& view, IndexVector& sortedRows);
+void countingSortRowsByTransactionType(const ChannelView& view, IndexVector& sortedRows);
+void radixSortRows(const ChannelView& view, IndexVector& sortedRows);
+void parallelMergeSortRows(const ChannelView& view, IndexVector& sortedRows);
+void parallelMergeSortRowsByTransactionType(const ChannelView& view, IndexVector& sortedRows);
+void gatherRows(const ChannelView& sortedView, DynamicArray& arr);
+
+// ============= INTROSORT ENGINE =============
+
+// Quick sort engine shared by every quick sort: ninther / median-of-three pivots,
+// three-way (Dutch flag) partitions so runs of equal keys are finished in one pass,
+// insertion sort below the cutoff, and heap sort once the depth limit is spent.
+const size_t INTROSORT_INSERTION_CUTOFF = 16;
+const size_t INTROSORT_NINTHER_THRESHOLD = 128;
+
+template <typename T, typename Less>
+void insertionSortRange(T* arr, size_t low, size_t high, Less less) {
+    for (size_t i = low + 1; i < high; i++) {
+        T value = move(arr[i]);
+        size_t j = i;
+        while (j > low && less(value, arr[j - 1])) {
+            arr[j] = move(arr[j - 1]);
+            j--;
+        }
+        arr[j] = move(value);
+    }
+}
+
+template <typename T, typename Less>
+void siftDownRange(T* arr, size_t n, size_t i, Less less) {
+    while (true) {
+        size_t largest = i;
+        size_t left = 2 * i + 1;
+        size_t right = 2 * i + 2;
+
+        if (left < n && less(arr[largest], arr[left])) largest = left;
+        if (right < n && less(arr[largest], arr[right])) largest = right;
+
+        if (largest == i) break;
+
+        swap(arr[i], arr[largest]);
+        i = largest;
+    }
+}
+
+template <typename T, typename Less>
+void heapSortRange(T* arr, size_t n, Less less) {
+    for (size_t i = n / 2; i-- > 0;) siftDownRange(arr, n, i, less);
+
+    for (size_t i = n - 1; i > 0; i--) {
+        swap(arr[0], arr[i]);
+        siftDownRange(arr, i, 0, less);
+    }
+}
+
+template <typename T, typename Less>
+size_t medianOfThree(const T* arr, size_t a, size_t b, size_t c, Less less) {
+    if (less(arr[b], arr[a])) swap(a, b);
+    if (less(arr[c], arr[b])) {
+        b = c;
+        if (less(arr[b], arr[a])) b = a;
+    }
+    return b;
+}
+
+// Median of three for short ranges, Tukey's ninther for long ones
+template <typename T, typename Less>
+size_t choosePivot(const T* arr, size_t low, size_t high, Less less) {
+    size_t n = high - low;
+    size_t mid = low + n / 2;
+    size_t last = high - 1;
+
+    if (n < INTROSORT_NINTHER_THRESHOLD) {
+        return medianOfThree(arr, low, mid, last, less);
+    }
+
+    size_t step = n / 8;
+    size_t a = medianOfThree(arr, low, low + step, low + 2 * step, less);
+    size_t b = medianOfThree(arr, mid - step, mid, mid + step, less);
+    size_t c = medianOfThree(arr, last - 2 * step, last - step, last, less);
+    return medianOfThree(arr, a, b, c, less);
+}
+
+// Sorts [low, high); recurses into the smaller side so the stack stays O(log n)
+template <typename T, typename Less>
+void introSortRange(T* arr, size_t low, size_t high, int depthLimit, Less less) {
+    while (high - low > INTROSORT_INSERTION_CUTOFF) {
+        if (depthLimit == 0) {
+            heapSortRange(arr + low, high - low, less);
+            return;
+        }
+        depthLimit--;
+
+        T pivot = arr[choosePivot(arr, low, high, less)];
+
+        // [low, lt) < pivot, [lt, gt) == pivot, [gt, high) > pivot
+        size_t lt = low, i = low, gt = high;
+        while (i < gt) {
+            if (less(arr[i], pivot)) {
+                swap(arr[lt++], arr[i++]);
+            } else if (less(pivot, arr[i])) {
+                swap(arr[i], arr[--gt]);
+            } else {
+                i++;
+            }
+        }
+
+        if (lt - low < high - gt) {
+            introSortRange(arr, low, lt, depthLimit, less);
+            low = gt;
+        } else {
+            introSortRange(arr, gt, high, depthLimit, less);
+            high = lt;
+        }
+    }
+
+    insertionSortRange(arr, low, high, less);
+}
+
+template <typename T, typename Less>
+void introSort(T* arr, size_t n, Less less) {
+    if (n <= 1) return;
+
+    int depthLimit = 0;
+    for (size_t m = n; m > 1; m >>= 1) depthLimit += 2;    // 2 * floor(log2 n)
+    introSortRange(arr, 0, n, depthLimit, less);
+}
+
+// ============= COUNTING / RADIX SORT ENGINE =============
+
+// Stable counting sort for keys already reduced to small integers (category ranks):
+// one pass to count, one to scatter, so O(n + keyCount) with no comparisons
+template <typename T, typename KeyOf>
+void countingSortBy(T* arr, size_t n, size_t keyCount, KeyOf keyOf) {
+    if (n <= 1) return;
+
+    size_t* starts = new size_t[keyCount + 1]();
+    for (size_t i = 0; i < n; i++) starts[keyOf(arr[i]) + 1]++;
+    for (size_t k = 0; k < keyCount; k++) starts[k + 1] += starts[k];
+
+    T* sorted = new T[n];
+    for (size_t i = 0; i < n; i++) sorted[starts[keyOf(arr[i])]++] = move(arr[i]);
+    for (size_t i = 0; i < n; i++) arr[i] = move(sorted[i]);
+
+    delete[] sorted;
+    delete[] starts;
+}
+
+const int RADIX_BUCKETS = 256;
+const int RADIX_END_BUCKET = 128;           // where byte 0 falls, so a key that ends sorts as fastStringCompare does
+const size_t RADIX_INSERTION_CUTOFF = 16;
+
+// Byte of the case-folded key at depth, ordered like fastStringCompare's signed
+// char differences; past the end (or at an embedded NUL) the key is finished
+inline int radixBucket(const string& key, size_t depth) {
+    if (depth >= key.size() || key[depth] == '\0') return RADIX_END_BUCKET;
+    char c = key[depth];
+    if (c >= 'A' && c <= 'Z') c += 32;
+    return (int)(signed char)c + 128;
+}
+
+// Same order as the buckets, starting at depth
+inline int compareRadixKeys(const string& a, const string& b, size_t depth) {
+    while (true) {
+        int bucketA = radixBucket(a, depth);
+        int bucketB = radixBucket(b, depth);
+        if (bucketA != bucketB || bucketA == RADIX_END_BUCKET) return bucketA - bucketB;
+        depth++;
+    }
+}
+
+// Every key in [low, high) shares its first depth folded bytes
+template <typename T, typename KeyOf>
+void msdRadixSortRange(T* arr, T* buffer, size_t low, size_t high, size_t depth, KeyOf keyOf) {
+    size_t n = high - low;
+
+    if (n <= RADIX_INSERTION_CUTOFF) {
+        for (size_t i = low + 1; i < high; i++) {
+            T value = move(arr[i]);
+            size_t j = i;
+            while (j > low && compareRadixKeys(keyOf(value), keyOf(arr[j - 1]), depth) < 0) {
+                arr[j] = move(arr[j - 1]);
+                j--;
+            }
+            arr[j] = move(value);
+        }
+        return;
+    }
+
+    size_t starts[RADIX_BUCKETS + 1] = {0};
+    for (size_t i = low; i < high; i++) starts[radixBucket(keyOf(arr[i]), depth) + 1]++;
+    for (int b = 0; b < RADIX_BUCKETS; b++) starts[b + 1] += starts[b];
+
+    size_t next[RADIX_BUCKETS];
+    for (int b = 0; b < RADIX_BUCKETS; b++) next[b] = starts[b];
+    for (size_t i = low; i < high; i++) {
+        buffer[next[radixBucket(keyOf(arr[i]), depth)]++] = move(arr[i]);
+    }
+    for (size_t i = 0; i < n; i++) arr[low + i] = move(buffer[i]);
+
+    // Keys that ended here are all equal; every other bucket goes one byte deeper
+    for (int b = 0; b < RADIX_BUCKETS; b++) {
+        if (b != RADIX_END_BUCKET && starts[b + 1] - starts[b] > 1) {
+            msdRadixSortRange(arr, buffer, low + starts[b], low + starts[b + 1], depth + 1, keyOf);
+        }
+    }
+}
+
+// Stable MSD radix sort on the case-folded bytes of a string key, in the same
+// order as fastStringCompare; keyOf returns the key as a const string&
+template <typename T, typename KeyOf>
+void msdRadixSort(T* arr, size_t n, KeyOf keyOf) {
+    if (n <= 1) return;
+
+    T* buffer = new T[n];
+    msdRadixSortRange(arr, buffer, 0, n, 0, keyOf);
+    delete[] buffer;
+}
 
 // ============= SEARCHING ALGORITHMS =============
 
-int binarySearch(const DynamicArray& arr, const string& transactionType);
-int binarySearchLL(const SinglyLinkedList& list, const string& transactionType);
-int interpolationSearch(const DynamicArray& arr, const string& transactionType);
-int interpolationSearchLL(const SinglyLinkedList& list, const string& transactionType);
-int exponentialSearch(const DynamicArray& arr, const string& transactionType);
-int exponentialSearchLL(const SinglyLinkedList& list, const string& transactionType);
+long long binarySearch(const DynamicArray& arr, const string& transactionType);
+long long binarySearchLL(const SinglyLinkedList& list, const string& transactionType);
+long long interpolationSearch(const DynamicArray& arr, const string& transactionType);
+long long interpolationSearchLL(const SinglyLinkedList& list, const string& transactionType);
+long long exponentialSearch(const DynamicArray& arr, const string& transactionType);
+long long exponentialSearchLL(const SinglyLinkedList& list, const string& transactionType);
+long long binarySearchLL(const UnrolledLinkedList& list, const string& transactionType);
+long long interpolationSearchLL(const UnrolledLinkedList& list, const string& transactionType);
+long long exponentialSearchLL(const UnrolledLinkedList& list, const string& transactionType);
+long long binarySearch(const TransactionStore& store, const string& transactionType);
+long long interpolationSearch(const TransactionStore& store, const string& transactionType);
+long long exponentialSearch(const TransactionStore& store, const string& transactionType);
+
+// ============= ALLOCATION TRACKING =============
+
+// Global operator new/delete count every heap block (memoryTracker.cpp)
+struct AllocationStats {
+    long long liveBytes;    // bytes allocated minus bytes freed since the scope began
+    size_t peakBytes;       // highest live total above the starting point
+    size_t allocations;
+    size_t deallocations;
+};
+
+// Measures one region of code. Scopes do not nest: starting one resets the
+// peak that an enclosing scope would read.
+class AllocationScope {
+private:
+    long long startLive;
+    size_t startAllocations;
+    size_t startDeallocations;
+
+public:
+    AllocationScope();
+    AllocationStats stats() const;
+};
+
+size_t getLiveAllocatedBytes();
 
 // ============= PERFORMANCE TESTING =============
 
-void runSortingPerformanceTest(ChannelArray& channelArrays, ChannelListArray& channelLists);
-void runSearchingPerformanceTest(ChannelArray& channelArrays, ChannelListArray& channelLists, const string& searchTerm);
+// Working sets are row indices into the master store; the array and list under
+// test are built from them one at a time
+void runSortingPerformanceTest(const ChannelArray& channelArrays, ListVariant variant = LIST_SINGLY);
+void runSearchingPerformanceTest(const ChannelArray& channelArrays, const string& searchTerm, ListVariant variant = LIST_SINGLY);
+ListVariant promptListVariant();
 
 // ============= STORAGE FUNCTIONS =============
 
@@ -172,17 +1086,18 @@ void storeFullReducedDataset();
 void storeChannelData(const ChannelArray& channelArrays);
 void displayChannelStorageMenu();
 void storeSortedDataAfterSorting(const ChannelArray& channelArrays);
-bool exportTransactionsToJson(const DynamicArray& transactions, const string& filename);
-bool loadFullDataset(const string& filename, DynamicArray& allData);
+bool exportTransactionsToJson(const ChannelView& transactions, const string& filename);
+bool exportTransactionsToJson(const TransactionStore& transactions, const string& filename);
+bool loadFullDataset(const string& filename, TransactionStore& allData, LoadMode mode = LOAD_MAPPED);
 
 // ============= DISPLAY FUNCTIONS =============
 
 void displayMenu();
 void displayChannelSeparation(const ChannelArray& channelArrays);
-void displayChannelSeparationLL(const ChannelListArray& channelLists);
 void getValidTransactionTypes(const ChannelArray& channelArrays, string validTypes[], int& validTypeCount);
 void displayValidTypes(const string validTypes[], int validTypeCount);
-void displayLoadingSeparationPerformance(int arrayTime, int listTime, int totalArrayTransactions, int totalListTransactions);
+void displayParseStats(const ParseStats& stats);
+void displayLoadPerformance(int loadTime, long long totalTransactions, size_t residentBytes);
 void displaySearchMenu();
 void displaySearchContinuationMenu();
 void displaySearchError(const string& searchTerm);
@@ -199,36 +1114,104 @@ bool fileExists(const string& filename);
 
 // Data Manipulation
 void swapTransactions(Transaction& a, Transaction& b);
+void swapTransactions(HotTransaction& a, HotTransaction& b);
 
 // Input Validation
 int getSafeIntegerInput(int min = 1, int max = 7);
 bool isValidSearchTerm(const string& searchTerm, const string validTypes[], int validTypeCount);
+CategoryColumn promptPartitionColumn();
+const char* partitionColumnLabel(CategoryColumn column);
 
 // String Processing Utilities
 char toLowerChar(char c);
 int fastStringCompare(const char* str1, const char* str2);
 bool fastLocationCompare(const Transaction& a, const Transaction& b);
 bool fastTypeCompare(const Transaction& a, const Transaction& b);
-
-// Memory Calculation Utilities
-size_t calculateAlgorithmMemoryOverhead(const string& algorithm, int dataSize, bool isLinkedList);
+bool fastLocationCompare(const HotTransaction& a, const HotTransaction& b);
+bool fastTypeCompare(const HotTransaction& a, const HotTransaction& b);
 
 // Data Structure Conversion Utilities
-Transaction* convertListToArray(const SinglyLinkedList& list);
-void convertListToArrayAndSort(SinglyLinkedList& list, void (*sortFunction)(Transaction*, int));
+HotTransaction* convertListToArray(const SinglyLinkedList& list);
+void convertListToArrayAndSort(SinglyLinkedList& list, void (*sortFunction)(HotTransaction*, size_t));
+void convertListToArrayAndSort(UnrolledLinkedList& list, void (*sortFunction)(HotTransaction*, size_t));
+CategoryCode* collectTransactionTypes(const UnrolledLinkedList& list);
+
+// Hot/Cold Record Utilities
+HotTransaction* buildHotRecords(const DynamicArray& arr);
+void applyHotOrder(DynamicArray& arr, const HotTransaction* hot);
 
 // Array Sort Functions for Helper
-void mergeSortArrayByLocation(Transaction* arr, int n);
-void mergeSortArrayByType(Transaction* arr, int n);
-void quickSortArray(Transaction* arr, int n);
-void heapSortArray(Transaction* arr, int n);
+void mergeSortArrayByLocation(HotTransaction* arr, size_t n);
+void mergeSortArrayByType(HotTransaction* arr, size_t n);
+void quickSortArray(HotTransaction* arr, size_t n);
+void heapSortArray(HotTransaction* arr, size_t n);
+void countingSortArray(HotTransaction* arr, size_t n);
+void countingSortArrayByType(HotTransaction* arr, size_t n);
+void radixSortArray(HotTransaction* arr, size_t n);
+void parallelMergeSortArray(HotTransaction* arr, size_t n);
+void parallelMergeSortArrayByType(HotTransaction* arr, size_t n);
 
 // JSON Formatting Utilities
 void writeJsonString(ofstream& file, const string& str);
 void writeJsonTransaction(ofstream& file, const Transaction& trans, bool isLast = false);
+void writeJsonTransaction(ofstream& file, const TransactionRow& row, bool isLast = false);
 
 // Data Processing with Error Handling
-bool imputeCSVData(const string& inputFile, const string& outputFile);
-bool processAndImputeData();
+void imputeCSVLine(string_view line, string& processedLine, int& imputedFields);
+bool processAndImputeData(ChannelArray& channelArrays);
+
+// ============= FUSED PREPROCESSING PIPELINE =============
+
+// Intermediate CSVs are only written when asked for
+struct PipelineOptions {
+    bool writeReducedCSV;
+    bool writeImputedCSV;
+    string reducedPath;
+    string imputedPath;
+
+    PipelineOptions() : writeReducedCSV(false), writeImputedCSV(false),
+                        reducedPath("reduced_dataset.csv"), imputedPath("imputed_dataset.csv") {}
+};
+
+bool runFusedPipeline(const string& inputFile, long long targetRows, SamplingMode mode, const PipelineOptions& options,
+                      ChannelArray& channelArrays);
+bool storeTransactionLine(string_view imputedLine, ChannelArray& channelArrays, ParseStats& parseStats);
+
+// ============= LIVE FEED FOLLOWING =============
+
+const int TAIL_POLL_INTERVAL_MS = 500;
+
+// Incrementally ingests an append-only CSV. Only bytes past the last offset are
+// read; a trailing line without its newline is carried until the rest arrives.
+class TailFollower {
+private:
+    string filename;
+    uint64_t offset;        // bytes of the file consumed so far
+    string pendingLine;     // incomplete last line
+    string readBuffer;
+    bool skipFirstLine;     // header, or the tail of a line we started in the middle of
+    long long loadedCount;
+    long long skippedCount;
+    ParseStats parseStats;
+
+public:
+    TailFollower(const string& filename, bool fromBeginning);
+    int poll(ChannelArray& channelArrays);
+    uint64_t getOffset() const;
+    long long getLoadedCount() const;
+    long long getSkippedCount() const;
+    const ParseStats& getParseStats() const;
+};
+
+bool followTransactionFeed(ChannelArray& channelArrays);
+
+// ============= BINARY SNAPSHOT =============
+
+// Columnar copy of the loaded channels, stored next to the CSV it came from
+// (imputed_dataset.csv -> imputed_dataset.snap) and mapped back without parsing
+string snapshotPathFor(const string& csvPath);
+bool writeSnapshot(const string& snapshotPath, const ChannelArray& channelArrays, const string& sourcePath);
+bool isSnapshotCurrent(const string& snapshotPath, const string& sourcePath);
+bool loadSnapshot(const string& snapshotPath, ChannelArray& channelArrays);
 
 #endif
@@ -9,7 +9,7 @@ void storeFullReducedDataset() {
         return;
     }
 
-    DynamicArray allData;
+    TransactionStore allData;
     cout << "Loading full reduced dataset (100,000 records)..." << endl;
 
     if (!loadFullDataset(imputedPath, allData)) {
@@ -32,30 +32,33 @@ void storeFullReducedDataset() {
 void storeSortedDataAfterSorting(const ChannelArray& channelArrays) {
     cout << "\n=== STORING SORTED DATA ===" << endl;
 
-    DynamicArray allSortedData;
-
-    // Combine all channel data
+    // Every row in channel order; the sort reorders these indices and the export
+    // reads the records straight from the master store
+    IndexVector allRows;
+    allRows.reserve(channelArrays.getSize());
     for (int i = 0; i < channelArrays.getChannelCount(); i++) {
-        const DynamicArray& channel = channelArrays.getChannel(i);
-        for (int j = 0; j < channel.getSize(); j++) {
-            allSortedData.push_back(channel[j]);
+        const IndexVector& channelRows = channelArrays.getChannel(i).getRows();
+        for (size_t j = 0; j < channelRows.getSize(); j++) {
+            allRows.push_back(channelRows[j]);
         }
     }
 
-    if (allSortedData.getSize() == 0) {
+    if (allRows.getSize() == 0) {
         displayGeneralError("No data available to store.");
         return;
     }
 
-    cout << "Sorting " << allSortedData.getSize() << " transactions by location..." << endl;
-    mergeSortIterative(allSortedData);
+    cout << "Sorting " << allRows.getSize() << " transactions by location..." << endl;
+    IndexVector sortedRows;
+    parallelMergeSortRows(ChannelView(channelArrays.getRecords(), allRows), sortedRows);
+    ChannelView sortedData(channelArrays.getRecords(), sortedRows);
 
     cout << "Storing sorted data to JSON..." << endl;
 
-    if (exportTransactionsToJson(allSortedData, "sorted_by_location.json")) {
+    if (exportTransactionsToJson(sortedData, "sorted_by_location.json")) {
         cout << "\n[SUCCESS] Sorted data stored!" << endl;
         cout << "File: sorted_by_location.json" << endl;
-        cout << "Records: " << allSortedData.getSize() << endl;
+        cout << "Records: " << sortedData.getSize() << endl;
         cout << "Sorted by: Location (Ascending)" << endl;
     } else {
         displayGeneralError("Failed to store sorted data.");
@@ -108,7 +111,7 @@ void storeChannelData(const ChannelArray& channelArrays) {
             continue;
         }
 
-        const DynamicArray& channelData = channelArrays.getChannel(channelIndex);
+        ChannelView channelData = channelArrays.getChannel(channelIndex);
         cout << "\nStoring " << channelData.getSize() << " " << targetChannel << " transactions..." << endl;
 
         if (exportTransactionsToJson(channelData, outputFilename)) {
@@ -139,146 +142,36 @@ void displayChannelStorageMenu() {
     cout << "Enter choice (1-5): ";
 }
 
-bool loadFullDataset(const string& filename, DynamicArray& allData) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+bool loadFullDataset(const string& filename, TransactionStore& allData, LoadMode mode) {
+    MappedFile input;
+    if (!input.open(filename, mode)) {
         cout << "Error: Cannot open file: " << filename << endl;
         return false;
     }
 
-    string line;
-    getline(file, line); // Skip header
+    CSVScanner scanner(input.data(), input.size());
+    string_view line;
+    scanner.nextLine(line); // Skip header
 
-    int loadedCount = 0;
+    Transaction trans;
 
-    while (getline(file, line)) {
+    while (scanner.nextLine(line)) {
         if (line.empty()) continue;
 
-        stringstream ss(line);
-        Transaction trans;
-        string field;
-
         try {
-            getline(ss, trans.transaction_id, ',');
-            getline(ss, trans.timestamp, ',');
-            getline(ss, trans.sender_account, ',');
-            getline(ss, trans.receiver_account, ',');
-
-            getline(ss, field, ',');
-            if (field.empty() || field == "Null" || field == "NULL") {
-                trans.amount = 0.0;
-            } else {
-                try {
-                    trans.amount = stod(field);
-                } catch (...) {
-                    trans.amount = 0.0;
-                }
-            }
-
-            getline(ss, trans.transaction_type, ',');
-            if (trans.transaction_type == "Null" || trans.transaction_type == "NULL") {
-                trans.transaction_type = "Unknown";
-            }
-
-            getline(ss, trans.merchant_category, ',');
-            if (trans.merchant_category == "Null" || trans.merchant_category == "NULL") {
-                trans.merchant_category = "Unknown";
-            }
-
-            getline(ss, trans.location, ',');
-            if (trans.location == "Null" || trans.location == "NULL") {
-                trans.location = "Unknown";
-            }
-
-            getline(ss, trans.device_used, ',');
-            if (trans.device_used == "Null" || trans.device_used == "NULL") {
-                trans.device_used = "Unknown";
-            }
-
-            getline(ss, field, ',');
-            if (field == "Null" || field == "NULL" || field.empty()) {
-                trans.is_fraud = false;
-            } else {
-                trans.is_fraud = (field == "1" || field == "true" || field == "TRUE");
-            }
-
-            getline(ss, trans.fraud_type, ',');
-            if (trans.fraud_type == "Null" || trans.fraud_type == "NULL") {
-                trans.fraud_type = "";
-            }
-
-            getline(ss, field, ',');
-            if (field.empty() || field == "Null" || field == "NULL") {
-                trans.time_since_last_transaction = 0.0;
-            } else {
-                try {
-                    trans.time_since_last_transaction = stod(field);
-                } catch (...) {
-                    trans.time_since_last_transaction = 0.0;
-                }
-            }
-
-            getline(ss, field, ',');
-            if (field.empty() || field == "Null" || field == "NULL") {
-                trans.spending_deviation_score = 0.0;
-            } else {
-                try {
-                    trans.spending_deviation_score = stod(field);
-                } catch (...) {
-                    trans.spending_deviation_score = 0.0;
-                }
-            }
-
-            getline(ss, field, ',');
-            if (field.empty() || field == "Null" || field == "NULL") {
-                trans.velocity_score = 0;
-            } else {
-                try {
-                    trans.velocity_score = stoi(field);
-                } catch (...) {
-                    trans.velocity_score = 0;
-                }
-            }
-
-            getline(ss, field, ',');
-            if (field.empty() || field == "Null" || field == "NULL") {
-                trans.geo_anomaly_score = 0.0;
-            } else {
-                try {
-                    trans.geo_anomaly_score = stod(field);
-                } catch (...) {
-                    trans.geo_anomaly_score = 0.0;
-                }
-            }
-
-            getline(ss, trans.payment_channel, ',');
-            if (trans.payment_channel == "Null" || trans.payment_channel == "NULL") {
-                trans.payment_channel = "Unknown";
-            }
-
-            getline(ss, trans.ip_address, ',');
-            if (trans.ip_address == "Null" || trans.ip_address == "NULL") {
-                trans.ip_address = "";
-            }
-
-            getline(ss, trans.device_hash);
-            if (trans.device_hash == "Null" || trans.device_hash == "NULL") {
-                trans.device_hash = "";
-            }
-
+            trans = Transaction();
+            parseTransactionFields(line, trans);
             allData.push_back(trans);
-            loadedCount++;
 
         } catch (...) {
             continue;
         }
     }
 
-    file.close();
     return true;
 }
 
-bool exportTransactionsToJson(const DynamicArray& transactions, const string& filename) {
+bool exportTransactionsToJson(const ChannelView& transactions, const string& filename) {
     ofstream file(filename);
     if (!file.is_open()) {
         cout << "Error: Cannot create JSON file: " << filename << endl;
@@ -287,7 +180,7 @@ bool exportTransactionsToJson(const DynamicArray& transactions, const string& fi
 
     file << "[\n";
 
-    for (int i = 0; i < transactions.getSize(); i++) {
+    for (size_t i = 0; i < transactions.getSize(); i++) {
         writeJsonTransaction(file, transactions[i], (i == transactions.getSize() - 1));
     }
 
@@ -296,3 +189,22 @@ bool exportTransactionsToJson(const DynamicArray& transactions, const string& fi
     file.close();
     return true;
 }
+
+bool exportTransactionsToJson(const TransactionStore& transactions, const string& filename) {
+    ofstream file(filename);
+    if (!file.is_open()) {
+        cout << "Error: Cannot create JSON file: " << filename << endl;
+        return false;
+    }
+
+    file << "[\n";
+
+    for (size_t i = 0; i < transactions.getSize(); i++) {
+        writeJsonTransaction(file, transactions.row(i), (i == transactions.getSize() - 1));
+    }
+
+    file << "]\n";
+
+    file.close();
+    return true;
+}
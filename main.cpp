@@ -1,13 +1,14 @@
 #include "fileManager.h"
 
 int main() {
+    // The one resident copy of the data; channels and search results are row indices into it
     ChannelArray channelArrays;
-    ChannelListArray channelLists;
 
-    bool dataProcessed = false;
+    // A current snapshot from an earlier run means Option 1 does not have to be repeated
+    bool dataProcessed = isSnapshotCurrent(snapshotPathFor("imputed_dataset.csv"), "imputed_dataset.csv");
     bool dataLoaded = false;
 
-    DynamicArray lastSearchResults;
+    IndexVector lastSearchResults;
     string lastSearchTerm = "";
     bool hasSearchResults = false;
 
@@ -16,17 +17,16 @@ int main() {
     while (true) {
         try {
             displayMenu();
-            choice = getSafeIntegerInput(1, 7);
+            choice = getSafeIntegerInput(1, 8);
 
             bool showContinuePrompt = true;
 
             switch (choice) {
             case 1: {
-                dataProcessed = processAndImputeData();
-                if (dataProcessed) {
-                    dataLoaded = false;
-                    hasSearchResults = false;
-                }
+                // The fused pipeline also fills the master store
+                dataProcessed = processAndImputeData(channelArrays);
+                dataLoaded = dataProcessed;
+                hasSearchResults = false;
                 break;
             }
 
@@ -49,34 +49,36 @@ int main() {
                         break;
                     }
 
-                    analyzePaymentChannels(imputedPath);
+                    // The snapshot holds the same rows already parsed; fall back to the CSV if it is stale or damaged
+                    string snapshotPath = snapshotPathFor(imputedPath);
+                    bool useSnapshot = isSnapshotCurrent(snapshotPath, imputedPath);
 
-                    auto arrayStartTime = high_resolution_clock::now();
-                    loadAndSeparateArray(imputedPath, channelArrays);
-                    auto arrayEndTime = high_resolution_clock::now();
-                    auto arrayTime = duration_cast<milliseconds>(arrayEndTime - arrayStartTime);
+                    if (!useSnapshot) {
+                        analyzePaymentChannels(imputedPath);
+                    }
 
-                    auto listStartTime = high_resolution_clock::now();
-                    loadAndSeparateLinkedList(imputedPath, channelLists);
-                    auto listEndTime = high_resolution_clock::now();
-                    auto listTime = duration_cast<milliseconds>(listEndTime - listStartTime);
+                    channelArrays.setPartitionColumn(promptPartitionColumn());
+                    lastSearchResults.clear();
 
-                    int totalArrayTransactions = 0;
-                    for (int i = 0; i < channelArrays.getChannelCount(); i++) {
-                        totalArrayTransactions += channelArrays.getChannel(i).getSize();
+                    // One parse (or snapshot restore) fills the master store and its channel partitions;
+                    // the linked lists are only built for the Option 3/4 comparisons
+                    auto loadStartTime = high_resolution_clock::now();
+                    if (!useSnapshot || !loadSnapshot(snapshotPath, channelArrays)) {
+                        useSnapshot = false;
+                        loadAndSeparateArray(imputedPath, channelArrays);
                     }
+                    auto loadEndTime = high_resolution_clock::now();
+                    auto loadTime = duration_cast<milliseconds>(loadEndTime - loadStartTime);
 
-                    int totalListTransactions = 0;
-                    for (int i = 0; i < channelLists.getChannelCount(); i++) {
-                        totalListTransactions += channelLists.getChannel(i).getSize();
+                    if (!useSnapshot) {
+                        writeSnapshot(snapshotPath, channelArrays, imputedPath);
                     }
 
                     dataLoaded = true;
                     hasSearchResults = false;
 
-                    displayLoadingSeparationPerformance(arrayTime.count(), listTime.count(), totalArrayTransactions, totalListTransactions);
+                    displayLoadPerformance(loadTime.count(), (long long)channelArrays.getSize(), getLiveAllocatedBytes());
                     displayChannelSeparation(channelArrays);
-                    displayChannelSeparationLL(channelLists);
 
                 } catch (const exception& e) {
                     displayGeneralError(e.what());
@@ -95,7 +97,8 @@ int main() {
                 }
 
                 try {
-                    runSortingPerformanceTest(channelArrays, channelLists);
+                    ListVariant variant = promptListVariant();
+                    runSortingPerformanceTest(channelArrays, variant);
 
                     // Auto-store sorted data after sorting
                     cout << "\nAutomatically storing sorted data..." << endl;
@@ -160,19 +163,23 @@ int main() {
                         }
                     }
 
+                    ListVariant variant = promptListVariant();
                     cout << "\n Starting search performance test..." << endl;
 
                     try {
-                        runSearchingPerformanceTest(channelArrays, channelLists, searchTerm);
+                        runSearchingPerformanceTest(channelArrays, searchTerm, variant);
 
                         lastSearchResults.clear();
                         lastSearchTerm = searchTerm;
 
-                        for (int i = 0; i < channelArrays.getChannelCount(); i++) {
-                            const DynamicArray& channel = channelArrays.getChannel(i);
-                            for (int j = 0; j < channel.getSize(); j++) {
-                                if (channel[j].transaction_type == searchTerm) {
-                                    lastSearchResults.push_back(channel[j]);
+                        // One lookup turns the term into a code; a term never seen matches nothing
+                        int searchCode = categoryTable.find(CATEGORY_TRANSACTION_TYPE, searchTerm);
+
+                        for (int i = 0; i < channelArrays.getChannelCount() && searchCode != -1; i++) {
+                            ChannelView channel = channelArrays.getChannel(i);
+                            for (size_t j = 0; j < channel.getSize(); j++) {
+                                if (channel[j].transaction_type == (CategoryCode)searchCode) {
+                                    lastSearchResults.push_back(channel.getRows()[j]);
                                 }
                             }
                         }
@@ -225,6 +232,13 @@ int main() {
                     break;
                 }
 
+                if (channelArrays.getPartitionColumn() != CATEGORY_PAYMENT_CHANNEL) {
+                    displayGeneralError("Reload the data partitioned by payment channel first (Option 2).");
+                    cin.get();
+                    showContinuePrompt = false;
+                    break;
+                }
+
                 try {
                     storeChannelData(channelArrays);
                 } catch (const exception& e) {
@@ -236,6 +250,21 @@ int main() {
             }
 
             case 7: {
+                // Appends to whatever is already loaded, or starts the stores from scratch
+                try {
+                    if (followTransactionFeed(channelArrays)) {
+                        dataLoaded = true;
+                        hasSearchResults = false;
+                    }
+                } catch (const exception& e) {
+                    displayGeneralError(e.what());
+                    cin.get();
+                    showContinuePrompt = false;
+                }
+                break;
+            }
+
+            case 8: {
                 displaySystemShutdown();
                 return 0;
             }
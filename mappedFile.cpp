@@ -0,0 +1,114 @@
+// Platform headers go first so <windows.h> does not collide with "using namespace std"
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "fileManager.h"
+
+// ============= MEMORY-MAPPED INPUT FILE =============
+
+MappedFile::MappedFile() {
+    mappedData = nullptr;
+    mappedSize = 0;
+    mapped = false;
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+// Maps the file read-only when mode is LOAD_MAPPED, otherwise (or if the
+// mapping fails) falls back to reading it into an owned buffer
+bool MappedFile::open(const string& filename, LoadMode mode) {
+    close();
+
+    if (mode == LOAD_MAPPED && mapFile(filename)) {
+        return true;
+    }
+
+    if (!readFileToBuffer(filename, buffer)) {
+        return false;
+    }
+    mappedSize = buffer.size();
+    return true;
+}
+
+bool MappedFile::mapFile(const string& filename) {
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(fileHandle);
+    if (mappingHandle == nullptr) return false;
+
+    void* view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mappingHandle);
+    if (view == nullptr) return false;
+
+    mappedData = (const char*)view;
+    mappedSize = (size_t)fileSize.QuadPart;
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0 || fileInfo.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, (size_t)fileInfo.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) return false;
+
+    // We walk the file front to back exactly once
+    madvise(view, (size_t)fileInfo.st_size, MADV_SEQUENTIAL);
+
+    mappedData = (const char*)view;
+    mappedSize = (size_t)fileInfo.st_size;
+#endif
+    mapped = true;
+    return true;
+}
+
+void MappedFile::close() {
+    if (mapped) {
+#ifdef _WIN32
+        UnmapViewOfFile((void*)mappedData);
+#else
+        munmap((void*)mappedData, mappedSize);
+#endif
+    }
+    mappedData = nullptr;
+    mappedSize = 0;
+    mapped = false;
+    buffer.clear();
+    buffer.shrink_to_fit();
+}
+
+const char* MappedFile::data() const {
+    return mapped ? mappedData : buffer.data();
+}
+
+size_t MappedFile::size() const {
+    return mappedSize;
+}
+
+bool MappedFile::isMapped() const {
+    return mapped;
+}
@@ -0,0 +1,111 @@
+#include "fileManager.h"
+#include <atomic>
+#include <cstdlib>
+
+// ============= ALLOCATION TRACKING =============
+
+// Every operator new in the program goes through here. Each block carries a
+// small header with its requested size, so delete can subtract exactly what
+// new added without asking the C library for block sizes.
+
+struct AllocationHeader {
+    size_t size;    // bytes the caller asked for
+    size_t offset;  // distance from the malloc'd pointer to the user pointer
+};
+
+// The header sits right before the user pointer, so it must not break the
+// default new alignment
+const size_t ALLOCATION_HEADER_BYTES = (sizeof(AllocationHeader) + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+
+static atomic<long long> liveBytes(0);
+static atomic<long long> peakBytes(0);
+static atomic<size_t> allocationCount(0);
+static atomic<size_t> deallocationCount(0);
+
+static void* trackedAllocate(size_t size, size_t alignment) {
+    if (alignment < alignof(max_align_t)) alignment = alignof(max_align_t);
+
+    size_t slack = (alignment > alignof(max_align_t)) ? alignment : 0;
+    unsigned char* raw = (unsigned char*)malloc(size + ALLOCATION_HEADER_BYTES + slack);
+    if (raw == nullptr) return nullptr;
+
+    uintptr_t first = (uintptr_t)(raw + ALLOCATION_HEADER_BYTES);
+    unsigned char* user = (unsigned char*)((first + alignment - 1) & ~(uintptr_t)(alignment - 1));
+
+    AllocationHeader* header = (AllocationHeader*)(user - sizeof(AllocationHeader));
+    header->size = size;
+    header->offset = (size_t)(user - raw);
+
+    long long live = liveBytes.fetch_add((long long)size, memory_order_relaxed) + (long long)size;
+    long long peak = peakBytes.load(memory_order_relaxed);
+    while (live > peak && !peakBytes.compare_exchange_weak(peak, live, memory_order_relaxed)) {
+    }
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    return user;
+}
+
+static void trackedFree(void* pointer) {
+    if (pointer == nullptr) return;
+
+    unsigned char* user = (unsigned char*)pointer;
+    AllocationHeader* header = (AllocationHeader*)(user - sizeof(AllocationHeader));
+
+    liveBytes.fetch_sub((long long)header->size, memory_order_relaxed);
+    deallocationCount.fetch_add(1, memory_order_relaxed);
+    free(user - header->offset);
+}
+
+static void* trackedAllocateOrThrow(size_t size, size_t alignment) {
+    void* pointer = trackedAllocate(size, alignment);
+    if (pointer == nullptr) throw bad_alloc();
+    return pointer;
+}
+
+void* operator new(size_t size) { return trackedAllocateOrThrow(size, 0); }
+void* operator new[](size_t size) { return trackedAllocateOrThrow(size, 0); }
+void* operator new(size_t size, const nothrow_t&) noexcept { return trackedAllocate(size, 0); }
+void* operator new[](size_t size, const nothrow_t&) noexcept { return trackedAllocate(size, 0); }
+void* operator new(size_t size, align_val_t alignment) { return trackedAllocateOrThrow(size, (size_t)alignment); }
+void* operator new[](size_t size, align_val_t alignment) { return trackedAllocateOrThrow(size, (size_t)alignment); }
+void* operator new(size_t size, align_val_t alignment, const nothrow_t&) noexcept { return trackedAllocate(size, (size_t)alignment); }
+void* operator new[](size_t size, align_val_t alignment, const nothrow_t&) noexcept { return trackedAllocate(size, (size_t)alignment); }
+
+void operator delete(void* pointer) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, const nothrow_t&) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, const nothrow_t&) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, align_val_t) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, align_val_t) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, size_t, align_val_t) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, size_t, align_val_t) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, align_val_t, const nothrow_t&) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, align_val_t, const nothrow_t&) noexcept { trackedFree(pointer); }
+
+// ============= ALLOCATION SCOPE =============
+
+// Starting a scope lowers the global peak to the current live total, so the
+// peak seen afterwards is the high-water mark of this region only
+AllocationScope::AllocationScope() {
+    startLive = liveBytes.load(memory_order_relaxed);
+    peakBytes.store(startLive, memory_order_relaxed);
+    startAllocations = allocationCount.load(memory_order_relaxed);
+    startDeallocations = deallocationCount.load(memory_order_relaxed);
+}
+
+AllocationStats AllocationScope::stats() const {
+    AllocationStats result;
+    long long peak = peakBytes.load(memory_order_relaxed) - startLive;
+
+    result.liveBytes = liveBytes.load(memory_order_relaxed) - startLive;
+    result.peakBytes = (peak > 0) ? (size_t)peak : 0;
+    result.allocations = allocationCount.load(memory_order_relaxed) - startAllocations;
+    result.deallocations = deallocationCount.load(memory_order_relaxed) - startDeallocations;
+    return result;
+}
+
+size_t getLiveAllocatedBytes() {
+    long long live = liveBytes.load(memory_order_relaxed);
+    return (live > 0) ? (size_t)live : 0;
+}
@@ -0,0 +1,51 @@
+#include "fileManager.h"
+
+// ============= PARTITION MAP =============
+
+PartitionMap::PartitionMap() : partitionForCode(nullptr), codeCapacity(0) {}
+
+PartitionMap::~PartitionMap() {
+    delete[] partitionForCode;
+}
+
+int PartitionMap::add(string_view name) {
+    return names.intern(name);
+}
+
+int PartitionMap::find(string_view name) const {
+    return names.find(name);
+}
+
+// Codes are dense per column, so the table is sized by the largest code seen
+void PartitionMap::bindCode(CategoryCode code, int partition) {
+    if (code >= (CategoryCode)codeCapacity) {
+        int newCapacity = (codeCapacity == 0) ? 16 : codeCapacity;
+        while ((CategoryCode)newCapacity <= code) newCapacity *= 2;
+
+        int* grown = new int[newCapacity];
+        for (int i = 0; i < codeCapacity; i++) grown[i] = partitionForCode[i];
+        for (int i = codeCapacity; i < newCapacity; i++) grown[i] = -1;
+        delete[] partitionForCode;
+        partitionForCode = grown;
+        codeCapacity = newCapacity;
+    }
+    partitionForCode[code] = partition;
+}
+
+const string& PartitionMap::name(int partition) const {
+    return names.lookup(partition);
+}
+
+int PartitionMap::size() const {
+    return names.size();
+}
+
+void PartitionMap::clear() {
+    names.clear();
+    for (int i = 0; i < codeCapacity; i++) partitionForCode[i] = -1;
+}
+
+string partitionNameFor(CategoryColumn column, CategoryCode code) {
+    const string& value = categoryName(column, code);
+    return value.empty() ? "Unknown" : value;
+}
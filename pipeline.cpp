@@ -0,0 +1,124 @@
+#include "fileManager.h"
+
+// ============= FUSED PREPROCESSING PIPELINE =============
+
+// Adds one imputed row to the master store, creating its partition on first sight
+bool storeTransactionLine(string_view imputedLine, ChannelArray& channelArrays, ParseStats& parseStats) {
+    Transaction trans;
+    parseTransactionFields(imputedLine, trans, &parseStats);
+
+    // Only skip if transaction_id is missing (less strict condition)
+    if (isMissingPrefixedKey(trans.transaction_id)) {
+        return false;
+    }
+
+    int channelIndex = channelArrays.partitionFor(trans);
+    channelArrays.add(channelIndex, move(trans));
+    return true;
+}
+
+// One scan of the source replaces reduce -> analyze -> impute -> analyze channels -> load x2.
+// The sampled rows stay in memory; each is checked for missing values, imputed,
+// tallied by channel and parsed into the master store before moving to the next.
+bool runFusedPipeline(const string& inputFile, long long targetRows, SamplingMode mode, const PipelineOptions& options,
+                      ChannelArray& channelArrays) {
+    auto startTime = high_resolution_clock::now();
+
+    string headerLine;
+    string* sample = nullptr;
+    long long sampledRows = 0;
+    long long totalValidLines = 0;
+
+    if (!sampleCSVLines(inputFile, targetRows, mode, headerLine, sample, sampledRows, totalValidLines)) {
+        return false;
+    }
+
+    ofstream reducedFile;
+    ofstream imputedFile;
+
+    if (options.writeReducedCSV) {
+        reducedFile.open(options.reducedPath, ios::binary);
+        if (!reducedFile.is_open()) {
+            cout << "Error: Cannot create " << options.reducedPath << endl;
+            delete[] sample;
+            return false;
+        }
+        reducedFile << headerLine << '\n';
+    }
+
+    if (options.writeImputedCSV) {
+        imputedFile.open(options.imputedPath, ios::binary);
+        if (!imputedFile.is_open()) {
+            cout << "Error: Cannot create " << options.imputedPath << endl;
+            delete[] sample;
+            return false;
+        }
+        imputedFile << headerLine << '\n';
+    }
+
+    channelArrays.clear();
+
+    int missingCounts[TRANSACTION_FIELD_COUNT] = {0};
+    int imputedFields = 0;
+    long long imputedRows = 0;
+    long long loadedCount = 0;
+    long long skippedCount = 0;
+    ChannelTally tally;
+    ParseStats parseStats;
+    string imputedLine;
+
+    for (long long i = 0; i < sampledRows; i++) {
+        // Each sampled line is released once stored, so peak memory stays near one copy of the data
+        string sampledLine;
+        sampledLine.swap(sample[i]);
+        string_view line = sampledLine;
+
+        countMissingFields(line, missingCounts);
+        if (options.writeReducedCSV) {
+            reducedFile << line << '\n';
+        }
+
+        if (line.empty()) continue;
+
+        imputeCSVLine(line, imputedLine, imputedFields);
+        imputedRows++;
+        if (options.writeImputedCSV) {
+            imputedFile << imputedLine << '\n';
+        }
+
+        tally.add(extractPaymentChannel(imputedLine));
+
+        try {
+            if (storeTransactionLine(imputedLine, channelArrays, parseStats)) {
+                loadedCount++;
+            } else {
+                skippedCount++;
+            }
+        } catch (const length_error&) {
+            parseStats.storeFullRows++;
+            skippedCount++;
+        } catch (...) {
+            skippedCount++;
+        }
+    }
+
+    delete[] sample;
+
+    auto endTime = high_resolution_clock::now();
+    auto duration = duration_cast<milliseconds>(endTime - startTime);
+
+    displayMissingValueReport(missingCounts, sampledRows);
+    cout << "\nProcessing completed: " << imputedRows << " rows, " << imputedFields << " fields imputed" << endl;
+    displayChannelDistribution(tally);
+
+    cout << "\nLoaded into the master store: " << loadedCount << " transactions" << endl;
+    if (skippedCount > 0) {
+        cout << "Skipped due to errors: " << skippedCount << " transactions" << endl;
+    }
+    displayParseStats(parseStats);
+    if (options.writeReducedCSV) cout << "Wrote " << options.reducedPath << endl;
+    if (options.writeImputedCSV) cout << "Wrote " << options.imputedPath << endl;
+    cout << "Fused pipeline time: " << duration.count() << " ms (single pass over the source)" << endl;
+
+    return true;
+}
@@ -1,128 +1,356 @@
 #include "fileManager.h"
+#include <random>
 
-bool reduceCSV(const string& inputFile, const string& outputFile, int targetRows)
+// Reads lines either from a memory-mapped file or, for "-", from standard input
+class SampleLineSource
 {
-    if (targetRows <= 0)
-    {
-        cout << "Error: Target rows must be greater than 0." << endl;
-        return false;
-    }
+private:
+    MappedFile input;
+    CSVScanner scanner;
+    bool fromStdin;
+    string stdinLine;
 
-    if (targetRows > 10000000)
-    {
-        cout << "Error: Target rows too large (max: 10,000,000)." << endl;
-        return false;
-    }
+public:
+    SampleLineSource() : scanner(nullptr, 0), fromStdin(false) {}
 
-    // First pass: Count valid lines
-    ifstream countFile(inputFile);
-    if (!countFile.is_open())
+    bool open(const string& inputFile)
     {
-        cout << "Error: Cannot open input file: " << inputFile << endl;
-        return false;
+        if (inputFile == "-")
+        {
+            fromStdin = true;
+            return true;
+        }
+        if (!input.open(inputFile))
+        {
+            return false;
+        }
+        scanner = CSVScanner(input.data(), input.size());
+        return true;
     }
 
-    string line;
-    int totalValidLines = 0;
-
-    // Skip header
-    if (getline(countFile, line)) {
-        // Header found
-    } else {
-        cout << "Error: Input file is empty." << endl;
-        countFile.close();
-        return false;
+    // Only possible for mapped files; leaves the source positioned after the header
+    void rewind()
+    {
+        string_view header;
+        scanner = CSVScanner(input.data(), input.size());
+        scanner.nextLine(header);
     }
 
-    // Count valid data lines
-    while (getline(countFile, line))
+    bool next(string_view& line)
     {
-        if (!line.empty() && line.find(',') != string::npos) // Basic validation
+        if (!fromStdin)
+        {
+            return scanner.nextLine(line);
+        }
+        if (!getline(cin, stdinLine))
+        {
+            return false;
+        }
+        if (!stdinLine.empty() && stdinLine.back() == '\r')
         {
-            totalValidLines++;
+            stdinLine.pop_back();
         }
+        line = stdinLine;
+        return true;
     }
-    countFile.close();
 
-    cout << "Original dataset size: " << totalValidLines << " valid data lines" << endl;
+    bool isSeekable() const { return !fromStdin; }
+    size_t sizeInBytes() const { return input.size(); }
+};
 
-    if (totalValidLines == 0)
+static inline bool isValidDataLine(string_view line)
+{
+    return !line.empty() && line.find(',') != string_view::npos; // Basic validation
+}
+
+static void siftSampleDown(long long positions[], string lines[], long long n, long long parent)
+{
+    while (true)
     {
-        cout << "Error: No valid data lines found." << endl;
-        return false;
-    }
+        long long largest = parent;
+        long long left = 2 * parent + 1;
+        long long right = 2 * parent + 2;
+
+        if (left < n && positions[left] > positions[largest]) largest = left;
+        if (right < n && positions[right] > positions[largest]) largest = right;
 
-    //Comment just for now:
-    //cout << "Reducing dataset to exactly " << targetRows << " rows..." << endl;
+        if (largest == parent) break;
 
-    // Second pass: Write exactly targetRows
-    ifstream inFile(inputFile);
-    ofstream outFile(outputFile);
+        swap(positions[parent], positions[largest]);
+        lines[parent].swap(lines[largest]);
+        parent = largest;
+    }
+}
 
-    if (!inFile.is_open() || !outFile.is_open())
+// Restores file order of a reservoir sample (heap sort on line positions)
+static void sortSampleByPosition(long long positions[], string lines[], long long n)
+{
+    for (long long i = n / 2 - 1; i >= 0; i--) siftSampleDown(positions, lines, n, i);
+
+    for (long long i = n - 1; i > 0; i--)
     {
-        cout << "Error: Cannot open files for processing." << endl;
-        return false;
+        swap(positions[0], positions[i]);
+        lines[0].swap(lines[i]);
+        siftSampleDown(positions, lines, i, 0);
     }
+}
 
-    try
+// Random sample of exactly min(targetRows, valid lines) rows, Algorithm R
+static long long sampleReservoir(SampleLineSource& source, string sample[], long long targetRows, long long& totalValidLines)
+{
+    long long* positions = new long long[targetRows];
+    mt19937_64 generator(RESERVOIR_SAMPLING_SEED);
+    string_view line;
+    long long kept = 0;
+
+    while (source.next(line))
     {
-        // Copy header
-        if (getline(inFile, line))
+        if (!isValidDataLine(line)) continue;
+
+        if (kept < targetRows)
+        {
+            sample[kept].assign(line.data(), line.size());
+            positions[kept] = totalValidLines;
+            kept++;
+        }
+        else
         {
-            outFile << line << endl;
+            unsigned long long slot = generator() % (unsigned long long)(totalValidLines + 1);
+            if (slot < (unsigned long long)targetRows)
+            {
+                sample[slot].assign(line.data(), line.size());
+                positions[slot] = totalValidLines;
+            }
         }
+        totalValidLines++;
+    }
 
-        int actualTarget = (totalValidLines < targetRows) ? totalValidLines : targetRows;
-        int writtenLines = 0;
+    sortSampleByPosition(positions, sample, kept);
+    delete[] positions;
+    return kept;
+}
 
-        if (totalValidLines <= targetRows)
+// Evenly spaced sample. The stride starts from an estimate of the line count
+// (file size / average line length) and is corrected on the fly: whenever the
+// buffer holds 2x targetRows lines, every other line is dropped and the stride
+// doubles. A final pick of the buffered lines nearest to the ideal positions
+// gives exactly targetRows rows.
+static long long sampleStride(SampleLineSource& source, string sample[], long long targetRows, long long& totalValidLines)
+{
+    // Small samples still get a few thousand candidates so the final pick stays even
+    const long long capacity = (targetRows < 4096) ? 8192 : targetRows * 2;
+    string* buffer = new string[capacity];
+    long long buffered = 0;
+    long long stride = 1;
+    bool strideEstimated = !source.isSeekable();
+    size_t bytesSeen = 0;
+    string_view line;
+
+    while (source.next(line))
+    {
+        if (!isValidDataLine(line)) continue;
+
+        // Estimate the stride once enough lines have been seen to know the average length.
+        // Aim for ~2x the buffer capacity so an underestimate of the row count still fills up.
+        if (!strideEstimated && stride == 1 && totalValidLines == 1000)
         {
-            // Copy all valid lines
-            while (getline(inFile, line) && writtenLines < totalValidLines)
+            double averageLength = (double)bytesSeen / totalValidLines;
+            double estimatedLines = (double)source.sizeInBytes() / averageLength;
+            long long estimatedStride = (long long)(estimatedLines / ((double)capacity * 2.0));
+            if (estimatedStride > 1)
             {
-                if (!line.empty() && line.find(',') != string::npos)
+                // Keep only the lines already buffered that sit on the new stride
+                long long write = 0;
+                for (long long read = 0; read < buffered; read += estimatedStride)
                 {
-                    outFile << line << endl;
-                    writtenLines++;
+                    buffer[write++].swap(buffer[read]);
                 }
+                buffered = write;
+                stride = estimatedStride;
             }
+            strideEstimated = true;
         }
-        else
-        {
-            // Calculate sampling interval
-            double interval = (double)totalValidLines / actualTarget;
-            double nextTargetPosition = 0.0;
-            int validLineCount = 0;
+        bytesSeen += line.size() + 1;
 
-            while (getline(inFile, line) && writtenLines < actualTarget)
+        if (totalValidLines % stride == 0)
+        {
+            if (buffered == capacity)
             {
-                if (!line.empty() && line.find(',') != string::npos)
+                long long write = 0;
+                for (long long read = 0; read < buffered; read += 2)
                 {
-                    if (validLineCount >= (int)nextTargetPosition)
-                    {
-                        outFile << line << endl;
-                        writtenLines++;
-                        nextTargetPosition += interval;
-                    }
-                    validLineCount++;
+                    buffer[write++].swap(buffer[read]);
                 }
+                buffered = write;
+                stride *= 2;
+            }
+
+            if (totalValidLines % stride == 0)
+            {
+                buffer[buffered++].assign(line.data(), line.size());
+            }
+        }
+        totalValidLines++;
+    }
+
+    long long kept = 0;
+    if (buffered <= targetRows)
+    {
+        for (long long i = 0; i < buffered; i++)
+        {
+            sample[kept++].swap(buffer[i]);
+        }
+    }
+    else
+    {
+        // buffer[j] holds valid line j * stride, so each ideal position
+        // i * total / targetRows maps to the nearest buffered line
+        long long last = -1;
+        for (long long i = 0; i < targetRows; i++)
+        {
+            long long ideal = (long long)((double)i * totalValidLines / targetRows);
+            long long j = (ideal + stride / 2) / stride;
+            if (j <= last) j = last + 1;
+            if (j > buffered - (targetRows - i)) j = buffered - (targetRows - i);
+
+            sample[kept++].swap(buffer[j]);
+            last = j;
+        }
+    }
+
+    delete[] buffer;
+    return kept;
+}
+
+// Evenly spaced pick when the number of valid lines is already known
+static long long sampleKnownCount(SampleLineSource& source, string sample[], long long targetRows, long long totalValidLines)
+{
+    double interval = (double)totalValidLines / targetRows;
+    double nextTargetPosition = 0.0;
+    long long validLineCount = 0;
+    long long kept = 0;
+    string_view line;
+
+    while (kept < targetRows && source.next(line))
+    {
+        if (!isValidDataLine(line)) continue;
+
+        if (validLineCount >= (long long)nextTargetPosition)
+        {
+            sample[kept++].assign(line.data(), line.size());
+            nextTargetPosition += interval;
+        }
+        validLineCount++;
+    }
+    return kept;
+}
+
+// Keeps every valid line. The array doubles as it fills; strings are swapped, not copied.
+static long long sampleAll(SampleLineSource& source, string*& sample, long long& totalValidLines)
+{
+    long long capacity = 1 << 16;
+    sample = new string[capacity];
+    string_view line;
+
+    while (source.next(line))
+    {
+        if (!isValidDataLine(line)) continue;
+
+        if (totalValidLines == capacity)
+        {
+            string* grown = new string[capacity * 2];
+            for (long long i = 0; i < capacity; i++)
+            {
+                grown[i].swap(sample[i]);
             }
+            delete[] sample;
+            sample = grown;
+            capacity *= 2;
         }
+        sample[totalValidLines++].assign(line.data(), line.size());
+    }
+    return totalValidLines;
+}
 
-        inFile.close();
-        outFile.close();
+// Single pass over the input: works for pipes as well as files.
+// On success sample holds sampledRows lines (caller deletes[] it).
+bool sampleCSVLines(const string& inputFile, long long targetRows, SamplingMode mode,
+                    string& headerLine, string*& sample, long long& sampledRows, long long& totalValidLines)
+{
+    sample = nullptr;
+    sampledRows = 0;
+    totalValidLines = 0;
 
-        cout << "Data reduction completed successfully." << endl;
+    if (mode != SAMPLE_ALL && targetRows <= 0)
+    {
+        cout << "Error: Target rows must be greater than 0." << endl;
+        return false;
+    }
 
-        return true;
+    SampleLineSource source;
+    if (!source.open(inputFile))
+    {
+        cout << "Error: Cannot open input file: " << inputFile << endl;
+        return false;
+    }
 
+    // A data line is at least a comma and a newline, so a file can never
+    // supply more rows than half its size; no need to allocate beyond that
+    if (source.isSeekable() && targetRows > (long long)(source.sizeInBytes() / 2) + 1)
+    {
+        targetRows = (long long)(source.sizeInBytes() / 2) + 1;
+    }
+
+    string_view header;
+    if (!source.next(header))
+    {
+        cout << "Error: Input file is empty." << endl;
+        return false;
+    }
+    headerLine.assign(header.data(), header.size());
+
+    try
+    {
+        if (mode == SAMPLE_ALL)
+        {
+            sampledRows = sampleAll(source, sample, totalValidLines);
+        }
+        else if (mode == SAMPLE_RESERVOIR)
+        {
+            sample = new string[targetRows];
+            sampledRows = sampleReservoir(source, sample, targetRows, totalValidLines);
+        }
+        else
+        {
+            sample = new string[targetRows];
+            sampledRows = sampleStride(source, sample, targetRows, totalValidLines);
+
+            // The stride estimate was badly off (first rows far longer than the rest):
+            // the line count is known now, so a mapped file can be rescanned once
+            if (sampledRows < targetRows && sampledRows < totalValidLines && source.isSeekable())
+            {
+                source.rewind();
+                sampledRows = sampleKnownCount(source, sample, targetRows, totalValidLines);
+            }
+        }
     }
     catch (const exception& e)
     {
         cout << "Error during reduction: " << e.what() << endl;
-        inFile.close();
-        outFile.close();
+        delete[] sample;
+        sample = nullptr;
+        return false;
+    }
+
+    cout << "Original dataset size: " << totalValidLines << " valid data lines" << endl;
+
+    if (totalValidLines == 0)
+    {
+        cout << "Error: No valid data lines found." << endl;
+        delete[] sample;
+        sample = nullptr;
         return false;
     }
+
+    return true;
 }
@@ -1,18 +1,18 @@
 #include "fileManager.h"
 
 // ============= BINARY SEARCH (ARRAYS) =============
-int binarySearch(const DynamicArray& arr, const string& transactionType) {
-    int size = arr.getSize();
+long long binarySearch(const DynamicArray& arr, const string& transactionType) {
+    long long size = (long long)arr.getSize();
     if (size == 0) return -1;
 
     const char* searchStr = transactionType.c_str();
-    int left = 0;
-    int right = size - 1;
+    long long left = 0;
+    long long right = size - 1;
 
     while (left <= right) {
-        int mid = left + ((right - left) >> 1);
+        long long mid = left + ((right - left) >> 1);
 
-        int cmp = fastStringCompare(arr[mid].transaction_type.c_str(), searchStr);
+        int cmp = fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, arr[mid].transaction_type).c_str(), searchStr);
 
         if (cmp == 0) {
             return mid;
@@ -26,22 +26,22 @@ int binarySearch(const DynamicArray& arr, const string& transactionType) {
 }
 
 // ============= BINARY SEARCH (LINKED LISTS) =============
-int binarySearchLL(const SinglyLinkedList& list, const string& transactionType) {
-    int size = list.getSize();
+long long binarySearchLL(const SinglyLinkedList& list, const string& transactionType) {
+    long long size = (long long)list.getSize();
     if (size == 0) return -1;
 
-    Transaction* tempArr = convertListToArray(list);
+    HotTransaction* tempArr = convertListToArray(list);
     if (!tempArr) return -1;
 
-    int left = 0;
-    int right = size - 1;
+    long long left = 0;
+    long long right = size - 1;
     const char* searchStr = transactionType.c_str();
-    int result = -1;
+    long long result = -1;
 
     while (left <= right) {
-        int mid = left + ((right - left) >> 1);
+        long long mid = left + ((right - left) >> 1);
 
-        int cmp = fastStringCompare(tempArr[mid].transaction_type.c_str(), searchStr);
+        int cmp = fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, tempArr[mid].transaction_type).c_str(), searchStr);
 
         if (cmp == 0) {
             result = mid;
@@ -58,34 +58,37 @@ int binarySearchLL(const SinglyLinkedList& list, const string& transactionType)
 }
 
 // ============= INTERPOLATION SEARCH (ARRAYS) =============
-int interpolationSearch(const DynamicArray& arr, const string& transactionType) {
-    int size = arr.getSize();
+long long interpolationSearch(const DynamicArray& arr, const string& transactionType) {
+    long long size = (long long)arr.getSize();
     if (size == 0) return -1;
 
     const char* searchStr = transactionType.c_str();
-    int low = 0;
-    int high = size - 1;
+    long long low = 0;
+    long long high = size - 1;
 
     while (low <= high && high < size) {
         if (low == high) {
-            return (fastStringCompare(arr[low].transaction_type.c_str(), searchStr) == 0) ? low : -1;
+            return (fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, arr[low].transaction_type).c_str(), searchStr) == 0) ? low : -1;
         }
 
         char searchChar = (transactionType.empty()) ? 'a' : toLowerChar(transactionType[0]);
-        char lowChar = toLowerChar(arr[low].transaction_type.empty() ? 'a' : arr[low].transaction_type[0]);
-        char highChar = toLowerChar(arr[high].transaction_type.empty() ? 'z' : arr[high].transaction_type[0]);
+        const string& lowType = categoryName(CATEGORY_TRANSACTION_TYPE, arr[low].transaction_type);
+        const string& highType = categoryName(CATEGORY_TRANSACTION_TYPE, arr[high].transaction_type);
+        char lowChar = toLowerChar(lowType.empty() ? 'a' : lowType[0]);
+        char highChar = toLowerChar(highType.empty() ? 'z' : highType[0]);
 
-        int pos;
+        long long pos;
         if (highChar == lowChar) {
             pos = low;
         } else {
             long long numerator = (long long)(searchChar - lowChar) * (high - low);
-            pos = low + (int)(numerator / (highChar - lowChar));
+            pos = low + numerator / (highChar - lowChar);
         }
 
-        pos = maxInt(low, minInt(pos, high));
+        if (pos < low) pos = low;
+        if (pos > high) pos = high;
 
-        int cmp = fastStringCompare(arr[pos].transaction_type.c_str(), searchStr);
+        int cmp = fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, arr[pos].transaction_type).c_str(), searchStr);
 
         if (cmp == 0) {
             return pos;
@@ -99,39 +102,42 @@ int interpolationSearch(const DynamicArray& arr, const string& transactionType)
 }
 
 // ============= INTERPOLATION SEARCH (LINKED LISTS) =============
-int interpolationSearchLL(const SinglyLinkedList& list, const string& transactionType) {
-    int size = list.getSize();
+long long interpolationSearchLL(const SinglyLinkedList& list, const string& transactionType) {
+    long long size = (long long)list.getSize();
     if (size == 0) return -1;
 
-    Transaction* tempArr = convertListToArray(list);
+    HotTransaction* tempArr = convertListToArray(list);
     if (!tempArr) return -1;
 
     const char* searchStr = transactionType.c_str();
-    int low = 0;
-    int high = size - 1;
-    int result = -1;
+    long long low = 0;
+    long long high = size - 1;
+    long long result = -1;
 
     while (low <= high && high < size) {
         if (low == high) {
-            result = (fastStringCompare(tempArr[low].transaction_type.c_str(), searchStr) == 0) ? low : -1;
+            result = (fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, tempArr[low].transaction_type).c_str(), searchStr) == 0) ? low : -1;
             break;
         }
 
         char searchChar = (transactionType.empty()) ? 'a' : toLowerChar(transactionType[0]);
-        char lowChar = toLowerChar(tempArr[low].transaction_type.empty() ? 'a' : tempArr[low].transaction_type[0]);
-        char highChar = toLowerChar(tempArr[high].transaction_type.empty() ? 'z' : tempArr[high].transaction_type[0]);
+        const string& lowType = categoryName(CATEGORY_TRANSACTION_TYPE, tempArr[low].transaction_type);
+        const string& highType = categoryName(CATEGORY_TRANSACTION_TYPE, tempArr[high].transaction_type);
+        char lowChar = toLowerChar(lowType.empty() ? 'a' : lowType[0]);
+        char highChar = toLowerChar(highType.empty() ? 'z' : highType[0]);
 
-        int pos;
+        long long pos;
         if (highChar == lowChar) {
             pos = low;
         } else {
             long long numerator = (long long)(searchChar - lowChar) * (high - low);
-            pos = low + (int)(numerator / (highChar - lowChar));
+            pos = low + numerator / (highChar - lowChar);
         }
 
-        pos = maxInt(low, minInt(pos, high));
+        if (pos < low) pos = low;
+        if (pos > high) pos = high;
 
-        int cmp = fastStringCompare(tempArr[pos].transaction_type.c_str(), searchStr);
+        int cmp = fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, tempArr[pos].transaction_type).c_str(), searchStr);
 
         if (cmp == 0) {
             result = pos;
@@ -148,28 +154,28 @@ int interpolationSearchLL(const SinglyLinkedList& list, const string& transactio
 }
 
 // ============= EXPONENTIAL SEARCH (ARRAYS) =============
-int exponentialSearch(const DynamicArray& arr, const string& transactionType) {
-    int size = arr.getSize();
+long long exponentialSearch(const DynamicArray& arr, const string& transactionType) {
+    long long size = (long long)arr.getSize();
     if (size == 0) return -1;
 
     const char* searchStr = transactionType.c_str();
 
-    if (fastStringCompare(arr[0].transaction_type.c_str(), searchStr) == 0) {
+    if (fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, arr[0].transaction_type).c_str(), searchStr) == 0) {
         return 0;
     }
 
-    int bound = 1;
-    while (bound < size && fastStringCompare(arr[bound].transaction_type.c_str(), searchStr) < 0) {
+    long long bound = 1;
+    while (bound < size && fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, arr[bound].transaction_type).c_str(), searchStr) < 0) {
         bound <<= 1;
     }
 
-    int left = bound >> 1;
-    int right = minInt(bound, size - 1);
+    long long left = bound >> 1;
+    long long right = (bound < size - 1) ? bound : size - 1;
 
     while (left <= right) {
-        int mid = left + ((right - left) >> 1);
+        long long mid = left + ((right - left) >> 1);
 
-        int cmp = fastStringCompare(arr[mid].transaction_type.c_str(), searchStr);
+        int cmp = fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, arr[mid].transaction_type).c_str(), searchStr);
 
         if (cmp == 0) {
             return mid;
@@ -183,33 +189,33 @@ int exponentialSearch(const DynamicArray& arr, const string& transactionType) {
 }
 
 // ============= EXPONENTIAL SEARCH (LINKED LISTS) =============
-int exponentialSearchLL(const SinglyLinkedList& list, const string& transactionType) {
-    int size = list.getSize();
+long long exponentialSearchLL(const SinglyLinkedList& list, const string& transactionType) {
+    long long size = (long long)list.getSize();
     if (size == 0) return -1;
 
-    Transaction* tempArr = convertListToArray(list);
+    HotTransaction* tempArr = convertListToArray(list);
     if (!tempArr) return -1;
 
     const char* searchStr = transactionType.c_str();
 
-    if (fastStringCompare(tempArr[0].transaction_type.c_str(), searchStr) == 0) {
+    if (fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, tempArr[0].transaction_type).c_str(), searchStr) == 0) {
         delete[] tempArr;
         return 0;
     }
 
-    int bound = 1;
-    while (bound < size && fastStringCompare(tempArr[bound].transaction_type.c_str(), searchStr) < 0) {
+    long long bound = 1;
+    while (bound < size && fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, tempArr[bound].transaction_type).c_str(), searchStr) < 0) {
         bound <<= 1;
     }
 
-    int left = bound >> 1;
-    int right = minInt(bound, size - 1);
-    int result = -1;
+    long long left = bound >> 1;
+    long long right = (bound < size - 1) ? bound : size - 1;
+    long long result = -1;
 
     while (left <= right) {
-        int mid = left + ((right - left) >> 1);
+        long long mid = left + ((right - left) >> 1);
 
-        int cmp = fastStringCompare(tempArr[mid].transaction_type.c_str(), searchStr);
+        int cmp = fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, tempArr[mid].transaction_type).c_str(), searchStr);
 
         if (cmp == 0) {
             result = mid;
@@ -224,3 +230,142 @@ int exponentialSearchLL(const SinglyLinkedList& list, const string& transactionT
     delete[] tempArr;
     return result;
 }
+
+// ============= SEARCHES OVER TYPE CODES =============
+// Used by the columnar store and the unrolled list; probes read only codes
+
+static long long binarySearchCodes(const CategoryCode* types, long long size, const string& transactionType) {
+    if (size == 0) return -1;
+
+    const char* searchStr = transactionType.c_str();
+    long long left = 0;
+    long long right = size - 1;
+
+    while (left <= right) {
+        long long mid = left + ((right - left) >> 1);
+
+        int cmp = fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, types[mid]).c_str(), searchStr);
+
+        if (cmp == 0) {
+            return mid;
+        } else if (cmp < 0) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+    return -1;
+}
+
+static long long interpolationSearchCodes(const CategoryCode* types, long long size, const string& transactionType) {
+    if (size == 0) return -1;
+
+    const char* searchStr = transactionType.c_str();
+    long long low = 0;
+    long long high = size - 1;
+
+    while (low <= high && high < size) {
+        if (low == high) {
+            return (fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, types[low]).c_str(), searchStr) == 0) ? low : -1;
+        }
+
+        char searchChar = (transactionType.empty()) ? 'a' : toLowerChar(transactionType[0]);
+        const string& lowType = categoryName(CATEGORY_TRANSACTION_TYPE, types[low]);
+        const string& highType = categoryName(CATEGORY_TRANSACTION_TYPE, types[high]);
+        char lowChar = toLowerChar(lowType.empty() ? 'a' : lowType[0]);
+        char highChar = toLowerChar(highType.empty() ? 'z' : highType[0]);
+
+        long long pos;
+        if (highChar == lowChar) {
+            pos = low;
+        } else {
+            long long numerator = (long long)(searchChar - lowChar) * (high - low);
+            pos = low + numerator / (highChar - lowChar);
+        }
+
+        if (pos < low) pos = low;
+        if (pos > high) pos = high;
+
+        int cmp = fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, types[pos]).c_str(), searchStr);
+
+        if (cmp == 0) {
+            return pos;
+        } else if (cmp < 0) {
+            low = pos + 1;
+        } else {
+            high = pos - 1;
+        }
+    }
+    return -1;
+}
+
+static long long exponentialSearchCodes(const CategoryCode* types, long long size, const string& transactionType) {
+    if (size == 0) return -1;
+
+    const char* searchStr = transactionType.c_str();
+
+    if (fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, types[0]).c_str(), searchStr) == 0) {
+        return 0;
+    }
+
+    long long bound = 1;
+    while (bound < size && fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, types[bound]).c_str(), searchStr) < 0) {
+        bound <<= 1;
+    }
+
+    long long left = bound >> 1;
+    long long right = (bound < size - 1) ? bound : size - 1;
+
+    while (left <= right) {
+        long long mid = left + ((right - left) >> 1);
+
+        int cmp = fastStringCompare(categoryName(CATEGORY_TRANSACTION_TYPE, types[mid]).c_str(), searchStr);
+
+        if (cmp == 0) {
+            return mid;
+        } else if (cmp < 0) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+    return -1;
+}
+
+// ============= SEARCHES (COLUMNAR STORE) =============
+
+long long binarySearch(const TransactionStore& store, const string& transactionType) {
+    return binarySearchCodes(store.transactionTypeColumn(), (long long)store.getSize(), transactionType);
+}
+
+long long interpolationSearch(const TransactionStore& store, const string& transactionType) {
+    return interpolationSearchCodes(store.transactionTypeColumn(), (long long)store.getSize(), transactionType);
+}
+
+long long exponentialSearch(const TransactionStore& store, const string& transactionType) {
+    return exponentialSearchCodes(store.transactionTypeColumn(), (long long)store.getSize(), transactionType);
+}
+
+// ============= SEARCHES (UNROLLED LISTS) =============
+
+static long long searchUnrolledList(const UnrolledLinkedList& list, const string& transactionType,
+                                    long long (*searchCodes)(const CategoryCode*, long long, const string&)) {
+    CategoryCode* types = collectTransactionTypes(list);
+    if (!types) return -1;
+
+    long long result = searchCodes(types, (long long)list.getSize(), transactionType);
+    delete[] types;
+    return result;
+}
+
+long long binarySearchLL(const UnrolledLinkedList& list, const string& transactionType) {
+    return searchUnrolledList(list, transactionType, binarySearchCodes);
+}
+
+long long interpolationSearchLL(const UnrolledLinkedList& list, const string& transactionType) {
+    return searchUnrolledList(list, transactionType, interpolationSearchCodes);
+}
+
+long long exponentialSearchLL(const UnrolledLinkedList& list, const string& transactionType) {
+    return searchUnrolledList(list, transactionType, exponentialSearchCodes);
+}
@@ -0,0 +1,164 @@
+#include "fileManager.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define DELIMITER_SCAN_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#define TARGET_SSE42 __attribute__((target("sse4.2")))
+#else
+#define TARGET_AVX2
+#define TARGET_SSE42
+#endif
+
+// ============= BLOCK KERNELS =============
+// Each kernel looks at exactly DELIMITER_BLOCK_SIZE bytes and sets bit i of a
+// mask when byte i is a comma, newline or double quote.
+
+static DelimiterMasks scanBlockScalar(const char* block) {
+    DelimiterMasks masks;
+    for (int i = 0; i < DELIMITER_BLOCK_SIZE; i++) {
+        char c = block[i];
+        if (c == ',') masks.commas |= (1u << i);
+        else if (c == '\n') masks.newlines |= (1u << i);
+        else if (c == '"') masks.quotes |= (1u << i);
+    }
+    return masks;
+}
+
+#ifdef DELIMITER_SCAN_X86
+TARGET_SSE42 static DelimiterMasks scanBlockSSE42(const char* block) {
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i quote = _mm_set1_epi8('"');
+
+    __m128i low = _mm_loadu_si128((const __m128i*)block);
+    __m128i high = _mm_loadu_si128((const __m128i*)(block + 16));
+
+    DelimiterMasks masks;
+    masks.commas = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(low, comma))
+                 | ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(high, comma)) << 16);
+    masks.newlines = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(low, newline))
+                   | ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(high, newline)) << 16);
+    masks.quotes = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(low, quote))
+                 | ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(high, quote)) << 16);
+    return masks;
+}
+
+TARGET_AVX2 static DelimiterMasks scanBlockAVX2(const char* block) {
+    __m256i bytes = _mm256_loadu_si256((const __m256i*)block);
+
+    DelimiterMasks masks;
+    masks.commas = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(',')));
+    masks.newlines = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n')));
+    masks.quotes = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('"')));
+    return masks;
+}
+#endif
+
+// ============= RUNTIME DISPATCH =============
+
+typedef DelimiterMasks (*BlockKernel)(const char* block);
+
+struct KernelChoice {
+    BlockKernel kernel;
+    const char* name;
+};
+
+static KernelChoice detectKernel() {
+    KernelChoice choice = { scanBlockScalar, "scalar" };
+
+#ifdef DELIMITER_SCAN_X86
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        choice.kernel = scanBlockAVX2;
+        choice.name = "AVX2";
+    } else if (__builtin_cpu_supports("sse4.2")) {
+        choice.kernel = scanBlockSSE42;
+        choice.name = "SSE4.2";
+    }
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    bool hasSSE42 = (info[2] & (1 << 20)) != 0;
+    bool hasOSXSAVE = (info[2] & (1 << 27)) != 0;
+    bool hasAVX = (info[2] & (1 << 28)) != 0;
+
+    __cpuidex(info, 7, 0);
+    bool hasAVX2 = (info[1] & (1 << 5)) != 0;
+
+    // The OS must also save the YMM registers on context switch
+    bool ymmEnabled = hasOSXSAVE && hasAVX && ((_xgetbv(0) & 0x6) == 0x6);
+
+    if (hasAVX2 && ymmEnabled) {
+        choice.kernel = scanBlockAVX2;
+        choice.name = "AVX2";
+    } else if (hasSSE42) {
+        choice.kernel = scanBlockSSE42;
+        choice.name = "SSE4.2";
+    }
+#endif
+#endif
+
+    return choice;
+}
+
+static const KernelChoice& activeKernel() {
+    static const KernelChoice choice = detectKernel();
+    return choice;
+}
+
+const char* getDelimiterKernelName() {
+    return activeKernel().name;
+}
+
+// Scans up to DELIMITER_BLOCK_SIZE bytes. Short tails are copied into a padded
+// block first so the vector kernels never read past the end of the input.
+DelimiterMasks scanDelimiters(const char* data, size_t length) {
+    if (length >= (size_t)DELIMITER_BLOCK_SIZE) {
+        return activeKernel().kernel(data);
+    }
+
+    char padded[DELIMITER_BLOCK_SIZE];
+    memset(padded, 0, sizeof(padded));
+    memcpy(padded, data, length);
+    return activeKernel().kernel(padded);
+}
+
+int countTrailingZeros(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int)index;
+#else
+    int count = 0;
+    while ((mask & 1u) == 0) {
+        mask >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+// Position of the first newline at or after data, or nullptr if none
+const char* findNewline(const char* data, const char* end) {
+    while (data < end) {
+        size_t length = (size_t)(end - data);
+        if (length > (size_t)DELIMITER_BLOCK_SIZE) length = DELIMITER_BLOCK_SIZE;
+
+        uint32_t newlines = scanDelimiters(data, length).newlines;
+        if (newlines != 0) {
+            return data + countTrailingZeros(newlines);
+        }
+        data += length;
+    }
+    return nullptr;
+}
@@ -0,0 +1,621 @@
+#include "fileManager.h"
+#include <filesystem>
+
+// ============= BINARY SNAPSHOT FORMAT =============
+//
+// [SnapshotHeader][column 0][column 1]...[column 19]
+//
+// The header holds an offsets table (one SnapshotColumn per CSV column, then
+// timestamp_ns and the fallback text table) and the size/mtime of the CSV the
+// rows came from. Every column starts on an 8-byte boundary so the mapped file
+// can be read in place:
+//   SNAPSHOT_F64 / SNAPSHOT_I32 / SNAPSHOT_I64 / SNAPSHOT_BOOL / SNAPSHOT_U64
+//                    fixed-width values, one per row
+//   SNAPSHOT_IP      uint32 address, uint32 fallback per row
+//   SNAPSHOT_HASH128 uint64 words[2] per row
+//   SNAPSHOT_DICT    uint32 entryOffsets[entries + 1], entry bytes, pad,
+//                    uint32 codes[rows]
+//   SNAPSHOT_STRING  uint64 rowOffsets[rows + 1], row bytes
+//   SNAPSHOT_TEXT_TABLE  uint32 entryOffsets[entries + 1], entry bytes
+// Identifier keys are stored in their compact form. Their fallback indices
+// point into the snapshot's own text table, which is interned again on load.
+// Values are stored in native byte order; the snapshot is a cache, not an
+// interchange format.
+
+static const char SNAPSHOT_MAGIC[8] = {'F', 'D', 'T', 'S', 'N', 'A', 'P', '\0'};
+static const uint32_t SNAPSHOT_VERSION = 2;
+
+enum SnapshotColumnKind {
+    SNAPSHOT_F64 = 1,
+    SNAPSHOT_I32 = 2,
+    SNAPSHOT_BOOL = 3,
+    SNAPSHOT_DICT = 4,
+    SNAPSHOT_STRING = 5,
+    SNAPSHOT_U64 = 6,
+    SNAPSHOT_IP = 7,
+    SNAPSHOT_HASH128 = 8,
+    SNAPSHOT_I64 = 9,
+    SNAPSHOT_TEXT_TABLE = 10
+};
+
+// After the CSV columns come timestamp_ns and the fallback text table
+const int SNAPSHOT_FALLBACK_COLUMN = TRANSACTION_FIELD_COUNT + 1;
+const int SNAPSHOT_COLUMN_COUNT = TRANSACTION_FIELD_COUNT + 2;
+
+struct SnapshotColumn {
+    uint32_t kind;
+    uint32_t entryCount;    // dictionary size for SNAPSHOT_DICT, otherwise 0
+    uint64_t offset;        // from the start of the file
+    uint64_t length;
+};
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t columnCount;
+    uint64_t rowCount;
+    uint64_t sourceSize;
+    int64_t sourceModified;
+    SnapshotColumn columns[SNAPSHOT_COLUMN_COUNT];
+};
+
+// Column layout, in CSV order; the fallback table comes last so the key columns can fill it
+static const SnapshotColumnKind SNAPSHOT_COLUMN_KINDS[SNAPSHOT_COLUMN_COUNT] = {
+    SNAPSHOT_U64,       // transaction_id
+    SNAPSHOT_STRING,    // timestamp, kept as text so exports match the CSV
+    SNAPSHOT_U64,       // sender_account
+    SNAPSHOT_U64,       // receiver_account
+    SNAPSHOT_F64,       // amount
+    SNAPSHOT_DICT,      // transaction_type
+    SNAPSHOT_DICT,      // merchant_category
+    SNAPSHOT_DICT,      // location
+    SNAPSHOT_DICT,      // device_used
+    SNAPSHOT_BOOL,      // is_fraud
+    SNAPSHOT_DICT,      // fraud_type
+    SNAPSHOT_F64,       // time_since_last_transaction
+    SNAPSHOT_F64,       // spending_deviation_score
+    SNAPSHOT_I32,       // velocity_score
+    SNAPSHOT_F64,       // geo_anomaly_score
+    SNAPSHOT_DICT,      // payment_channel
+    SNAPSHOT_IP,        // ip_address
+    SNAPSHOT_HASH128,   // device_hash
+    SNAPSHOT_I64,       // timestamp_ns
+    SNAPSHOT_TEXT_TABLE // fallback text of the key columns
+};
+
+static inline uint64_t alignSnapshotOffset(uint64_t offset) {
+    return (offset + 7) & ~(uint64_t)7;
+}
+
+// SNAPSHOT_U64 columns are the prefixed keys
+static PrefixedKey* keyColumn(Transaction& trans, int column) {
+    switch (column) {
+        case 0: return &trans.transaction_id;
+        case 2: return &trans.sender_account;
+        case 3: return &trans.receiver_account;
+        default: return nullptr;
+    }
+}
+
+static PrefixedKey keyColumn(const Transaction& trans, int column) {
+    return *keyColumn(const_cast<Transaction&>(trans), column);
+}
+
+static bool isFallbackDeviceHash(const DeviceHash& hash) {
+    unsigned char first;
+    memcpy(&first, hash.words, 1);
+    return first == DEVICE_HASH_FALLBACK_MARK;
+}
+
+// Dictionary columns are the categorical ones held as categoryTable codes
+static CategoryColumn categoryOfColumn(int column) {
+    switch (column) {
+        case 5: return CATEGORY_TRANSACTION_TYPE;
+        case 6: return CATEGORY_MERCHANT;
+        case 7: return CATEGORY_LOCATION;
+        case 8: return CATEGORY_DEVICE;
+        case 10: return CATEGORY_FRAUD_TYPE;
+        default: return CATEGORY_PAYMENT_CHANNEL;
+    }
+}
+
+static CategoryCode* categoryColumn(Transaction& trans, int column) {
+    switch (column) {
+        case 5: return &trans.transaction_type;
+        case 6: return &trans.merchant_category;
+        case 7: return &trans.location;
+        case 8: return &trans.device_used;
+        case 10: return &trans.fraud_type;
+        case 15: return &trans.payment_channel;
+        default: return nullptr;
+    }
+}
+
+static double* doubleColumn(Transaction& trans, int column) {
+    switch (column) {
+        case 4: return &trans.amount;
+        case 11: return &trans.time_since_last_transaction;
+        case 12: return &trans.spending_deviation_score;
+        case 14: return &trans.geo_anomaly_score;
+        default: return nullptr;
+    }
+}
+
+static double doubleColumn(const Transaction& trans, int column) {
+    return *doubleColumn(const_cast<Transaction&>(trans), column);
+}
+
+static CategoryCode categoryColumn(const Transaction& trans, int column) {
+    return *categoryColumn(const_cast<Transaction&>(trans), column);
+}
+
+// Size and modification time of the CSV a snapshot was built from
+static bool getSourceStamp(const string& sourcePath, uint64_t& sourceSize, int64_t& sourceModified) {
+    error_code error;
+    uintmax_t size = filesystem::file_size(sourcePath, error);
+    if (error) return false;
+    auto modified = filesystem::last_write_time(sourcePath, error);
+    if (error) return false;
+
+    sourceSize = (uint64_t)size;
+    sourceModified = (int64_t)modified.time_since_epoch().count();
+    return true;
+}
+
+string snapshotPathFor(const string& csvPath) {
+    size_t dot = csvPath.find_last_of('.');
+    size_t slash = csvPath.find_last_of("/\\");
+    if (dot == string::npos || (slash != string::npos && dot < slash)) {
+        return csvPath + ".snap";
+    }
+    return csvPath.substr(0, dot) + ".snap";
+}
+
+// ============= SNAPSHOT WRITER =============
+
+// fallbackStrings indices are per run, so keys are written with an index into
+// the snapshot's own table instead
+static uint32_t snapshotFallback(StringDictionary& fallbacks, uint32_t runIndex) {
+    return (uint32_t)fallbacks.intern(fallbackStrings.lookup(runIndex));
+}
+
+// uint32 entryOffsets[entries + 1], then the entry bytes
+static void appendTextTable(string& out, const StringDictionary& dictionary) {
+    uint32_t entryOffset = 0;
+    out.append((const char*)&entryOffset, sizeof(entryOffset));
+    for (int code = 0; code < dictionary.size(); code++) {
+        entryOffset += (uint32_t)dictionary.lookup(code).size();
+        out.append((const char*)&entryOffset, sizeof(entryOffset));
+    }
+    for (int code = 0; code < dictionary.size(); code++) {
+        out += dictionary.lookup(code);
+    }
+}
+
+// Encodes one column of every row in master store order, so a restore rebuilds
+// the same record order (and the same channels) as loading the CSV
+static void encodeColumn(const ChannelArray& channelArrays, int column, string& out, uint32_t& entryCount,
+                         StringDictionary& fallbacks) {
+    SnapshotColumnKind kind = SNAPSHOT_COLUMN_KINDS[column];
+    entryCount = 0;
+
+    if (kind == SNAPSHOT_TEXT_TABLE) {
+        entryCount = (uint32_t)fallbacks.size();
+        appendTextTable(out, fallbacks);
+        return;
+    }
+
+    const DynamicArray& records = channelArrays.getRecords();
+    uint64_t rowCount = records.getSize();
+
+    if (kind == SNAPSHOT_DICT) {
+        // Table codes are per run, so the snapshot gets its own dictionary of the values in use
+        CategoryColumn category = categoryOfColumn(column);
+        int tableSize = categoryTable.size(category);
+        int* snapshotCodeFor = new int[tableSize];
+        for (int i = 0; i < tableSize; i++) snapshotCodeFor[i] = -1;
+
+        StringDictionary dictionary;
+        uint32_t* codes = new uint32_t[rowCount > 0 ? rowCount : 1];
+
+        for (uint64_t row = 0; row < rowCount; row++) {
+            CategoryCode code = categoryColumn(records[row], column);
+            if (snapshotCodeFor[code] == -1) {
+                snapshotCodeFor[code] = dictionary.intern(categoryName(category, code));
+            }
+            codes[row] = (uint32_t)snapshotCodeFor[code];
+        }
+        delete[] snapshotCodeFor;
+
+        entryCount = (uint32_t)dictionary.size();
+        appendTextTable(out, dictionary);
+        out.resize(alignSnapshotOffset(out.size()), '\0');
+        out.append((const char*)codes, rowCount * sizeof(uint32_t));
+        delete[] codes;
+        return;
+    }
+
+    if (kind == SNAPSHOT_STRING) {
+        string rowBytes;
+        uint64_t rowOffset = 0;
+        out.append((const char*)&rowOffset, sizeof(rowOffset));
+        for (uint64_t row = 0; row < rowCount; row++) {
+            rowBytes += records[row].timestamp;
+            rowOffset = rowBytes.size();
+            out.append((const char*)&rowOffset, sizeof(rowOffset));
+        }
+        out += rowBytes;
+        return;
+    }
+
+    for (uint64_t row = 0; row < rowCount; row++) {
+        const Transaction& trans = records[row];
+        if (kind == SNAPSHOT_F64) {
+            double value = doubleColumn(trans, column);
+            out.append((const char*)&value, sizeof(value));
+        } else if (kind == SNAPSHOT_I32) {
+            int32_t value = trans.velocity_score;
+            out.append((const char*)&value, sizeof(value));
+        } else if (kind == SNAPSHOT_I64) {
+            int64_t value = trans.timestamp_ns;
+            out.append((const char*)&value, sizeof(value));
+        } else if (kind == SNAPSHOT_U64) {
+            PrefixedKey key = keyColumn(trans, column);
+            if (key & PREFIXED_KEY_FALLBACK) {
+                key = PREFIXED_KEY_FALLBACK | snapshotFallback(fallbacks, (uint32_t)(key & ~PREFIXED_KEY_FALLBACK));
+            }
+            out.append((const char*)&key, sizeof(key));
+        } else if (kind == SNAPSHOT_IP) {
+            uint32_t words[2] = {trans.ip_address.address, trans.ip_address.fallback};
+            if (words[1] != IP_ADDRESS_NUMERIC) words[1] = snapshotFallback(fallbacks, words[1]);
+            out.append((const char*)words, sizeof(words));
+        } else if (kind == SNAPSHOT_HASH128) {
+            uint64_t words[2] = {trans.device_hash.words[0], trans.device_hash.words[1]};
+            if (isFallbackDeviceHash(trans.device_hash)) words[1] = snapshotFallback(fallbacks, (uint32_t)words[1]);
+            out.append((const char*)words, sizeof(words));
+        } else {
+            uint8_t value = trans.is_fraud ? 1 : 0;
+            out.append((const char*)&value, sizeof(value));
+        }
+    }
+}
+
+bool writeSnapshot(const string& snapshotPath, const ChannelArray& channelArrays, const string& sourcePath) {
+    auto startTime = high_resolution_clock::now();
+
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.columnCount = SNAPSHOT_COLUMN_COUNT;
+
+    if (!getSourceStamp(sourcePath, header.sourceSize, header.sourceModified)) {
+        cout << "Warning: Cannot stat " << sourcePath << ", snapshot not written." << endl;
+        return false;
+    }
+
+    header.rowCount = channelArrays.getSize();
+
+    // Write to a temporary name first so a crash never leaves a half-written snapshot
+    string tempPath = snapshotPath + ".tmp";
+    ofstream outFile(tempPath, ios::binary);
+    if (!outFile.is_open()) {
+        cout << "Warning: Cannot create " << snapshotPath << endl;
+        return false;
+    }
+
+    outFile.write((const char*)&header, sizeof(header));
+    uint64_t offset = sizeof(header);
+    string columnData;
+    StringDictionary fallbacks;
+
+    for (int column = 0; column < SNAPSHOT_COLUMN_COUNT; column++) {
+        uint64_t alignedOffset = alignSnapshotOffset(offset);
+        static const char padding[8] = {0};
+        outFile.write(padding, (streamsize)(alignedOffset - offset));
+        offset = alignedOffset;
+
+        columnData.clear();
+        encodeColumn(channelArrays, column, columnData, header.columns[column].entryCount, fallbacks);
+
+        header.columns[column].kind = SNAPSHOT_COLUMN_KINDS[column];
+        header.columns[column].offset = offset;
+        header.columns[column].length = columnData.size();
+
+        outFile.write(columnData.data(), (streamsize)columnData.size());
+        offset += columnData.size();
+    }
+
+    // Offsets table is only known now
+    outFile.seekp(0);
+    outFile.write((const char*)&header, sizeof(header));
+    outFile.close();
+
+    if (!outFile) {
+        cout << "Warning: Failed writing " << snapshotPath << endl;
+        error_code ignored;
+        filesystem::remove(tempPath, ignored);
+        return false;
+    }
+
+    error_code error;
+    filesystem::rename(tempPath, snapshotPath, error);
+    if (error) {
+        cout << "Warning: Cannot replace " << snapshotPath << ": " << error.message() << endl;
+        filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    auto duration = duration_cast<milliseconds>(high_resolution_clock::now() - startTime);
+    cout << "Wrote " << snapshotPath << " (" << header.rowCount << " rows, " << offset / 1024 << " KB) in "
+         << duration.count() << " ms" << endl;
+    return true;
+}
+
+// ============= SNAPSHOT READER =============
+
+// Checks the header and offsets table against the mapped size
+static bool validateSnapshot(const MappedFile& input, const SnapshotHeader*& header) {
+    if (input.size() < sizeof(SnapshotHeader)) return false;
+
+    header = (const SnapshotHeader*)input.data();
+    if (memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) return false;
+    if (header->version != SNAPSHOT_VERSION) return false;
+    if (header->columnCount != SNAPSHOT_COLUMN_COUNT) return false;
+
+    // Every row takes at least one byte, which also keeps the size checks below from overflowing
+    uint64_t rows = header->rowCount;
+    if (rows > input.size() || rows > MAX_STORE_ROWS) return false;
+
+    for (int column = 0; column < SNAPSHOT_COLUMN_COUNT; column++) {
+        const SnapshotColumn& entry = header->columns[column];
+        if (entry.kind != (uint32_t)SNAPSHOT_COLUMN_KINDS[column]) return false;
+        if (entry.offset % 8 != 0) return false;
+        if (entry.offset > input.size() || entry.length > input.size() - entry.offset) return false;
+
+        uint64_t minimum = 0;
+        switch (entry.kind) {
+            case SNAPSHOT_F64: minimum = rows * sizeof(double); break;
+            case SNAPSHOT_I32: minimum = rows * sizeof(int32_t); break;
+            case SNAPSHOT_I64: minimum = rows * sizeof(int64_t); break;
+            case SNAPSHOT_U64: minimum = rows * sizeof(uint64_t); break;
+            case SNAPSHOT_IP: minimum = rows * 2 * sizeof(uint32_t); break;
+            case SNAPSHOT_HASH128: minimum = rows * 2 * sizeof(uint64_t); break;
+            case SNAPSHOT_BOOL: minimum = rows; break;
+            case SNAPSHOT_STRING: minimum = (rows + 1) * sizeof(uint64_t); break;
+            case SNAPSHOT_DICT:
+            case SNAPSHOT_TEXT_TABLE:
+                // Each entry needs its 4-byte offset, so a count larger than the column is damage
+                if (entry.entryCount > entry.length / sizeof(uint32_t)) return false;
+                minimum = ((uint64_t)entry.entryCount + 1) * sizeof(uint32_t);
+                if (entry.kind == SNAPSHOT_DICT) minimum += rows * sizeof(uint32_t);
+                break;
+        }
+        if (entry.length < minimum) return false;
+    }
+    return true;
+}
+
+bool isSnapshotCurrent(const string& snapshotPath, const string& sourcePath) {
+    uint64_t sourceSize = 0;
+    int64_t sourceModified = 0;
+    if (!getSourceStamp(sourcePath, sourceSize, sourceModified)) return false;
+
+    ifstream inFile(snapshotPath, ios::binary);
+    if (!inFile.is_open()) return false;
+
+    SnapshotHeader header;
+    if (!inFile.read((char*)&header, sizeof(header))) return false;
+
+    return memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) == 0 &&
+           header.version == SNAPSHOT_VERSION &&
+           header.sourceSize == sourceSize &&
+           header.sourceModified == sourceModified;
+}
+
+// Pointers into the mapped columns; nothing is parsed, only copied out
+struct SnapshotColumnView {
+    const char* data;
+    const uint64_t* rowOffsets;     // SNAPSHOT_STRING
+    const char* rowBytes;
+    uint64_t rowBytesLength;
+    const uint32_t* entryOffsets;   // SNAPSHOT_DICT, SNAPSHOT_TEXT_TABLE
+    const char* entryBytes;
+    const uint32_t* codes;
+    uint32_t entryCount;
+    CategoryCode* tableCodes;       // snapshot code -> categoryTable code
+    uint32_t* fallbackIndices;      // snapshot fallback -> fallbackStrings index
+};
+
+static void closeColumnViews(SnapshotColumnView views[]) {
+    for (int column = 0; column < SNAPSHOT_COLUMN_COUNT; column++) {
+        delete[] views[column].tableCodes;
+        delete[] views[column].fallbackIndices;
+        views[column].tableCodes = nullptr;
+        views[column].fallbackIndices = nullptr;
+    }
+}
+
+// Checks the offsets of a dictionary or text table and returns the length they cover
+static bool openEntryOffsets(SnapshotColumnView& view, const SnapshotColumn& entry, uint64_t& tableLength) {
+    view.entryCount = entry.entryCount;
+    view.entryOffsets = (const uint32_t*)view.data;
+    uint64_t offsetsLength = ((uint64_t)entry.entryCount + 1) * sizeof(uint32_t);
+    view.entryBytes = view.data + offsetsLength;
+
+    // The last offset is the entry byte total, which has to fit in the column
+    uint64_t entryBytesLength = view.entryOffsets[entry.entryCount];
+    if (entryBytesLength > entry.length - offsetsLength) return false;
+
+    for (uint32_t code = 0; code < entry.entryCount; code++) {
+        if (view.entryOffsets[code] > view.entryOffsets[code + 1]) return false;
+    }
+    tableLength = offsetsLength + entryBytesLength;
+    return true;
+}
+
+static string_view entryText(const SnapshotColumnView& view, uint32_t code) {
+    return string_view(view.entryBytes + view.entryOffsets[code], view.entryOffsets[code + 1] - view.entryOffsets[code]);
+}
+
+// Each dictionary entry and fallback text is interned once here, so rows only copy codes
+static bool openColumnViews(const char* base, const SnapshotHeader* header, SnapshotColumnView views[]) {
+    uint64_t rows = header->rowCount;
+
+    for (int column = 0; column < SNAPSHOT_COLUMN_COUNT; column++) {
+        memset(&views[column], 0, sizeof(SnapshotColumnView));
+    }
+
+    for (int column = 0; column < SNAPSHOT_COLUMN_COUNT; column++) {
+        const SnapshotColumn& entry = header->columns[column];
+        SnapshotColumnView& view = views[column];
+        view.data = base + entry.offset;
+
+        if (entry.kind == SNAPSHOT_STRING) {
+            view.rowOffsets = (const uint64_t*)view.data;
+            view.rowBytes = view.data + (rows + 1) * sizeof(uint64_t);
+            view.rowBytesLength = entry.length - (rows + 1) * sizeof(uint64_t);
+            if (view.rowOffsets[rows] > view.rowBytesLength) return false;
+        } else if (entry.kind == SNAPSHOT_DICT) {
+            uint64_t tableLength = 0;
+            if (!openEntryOffsets(view, entry, tableLength)) return false;
+
+            uint64_t codesOffset = alignSnapshotOffset(tableLength);
+            if (codesOffset > entry.length || rows * sizeof(uint32_t) > entry.length - codesOffset) return false;
+            view.codes = (const uint32_t*)(view.data + codesOffset);
+
+            view.tableCodes = new CategoryCode[(size_t)entry.entryCount + 1];
+            for (uint32_t code = 0; code < entry.entryCount; code++) {
+                view.tableCodes[code] = categoryTable.intern(categoryOfColumn(column), entryText(view, code));
+            }
+        } else if (entry.kind == SNAPSHOT_TEXT_TABLE) {
+            uint64_t tableLength = 0;
+            if (!openEntryOffsets(view, entry, tableLength)) return false;
+
+            view.fallbackIndices = new uint32_t[(size_t)entry.entryCount + 1];
+            for (uint32_t code = 0; code < entry.entryCount; code++) {
+                view.fallbackIndices[code] = fallbackStrings.intern(entryText(view, code));
+            }
+        }
+    }
+    return true;
+}
+
+// Swaps a snapshot fallback index for this run's fallbackStrings index
+static bool restoreFallback(const SnapshotColumnView& fallbacks, uint64_t snapshotIndex, uint32_t& runIndex) {
+    if (snapshotIndex >= fallbacks.entryCount) return false;
+    runIndex = fallbacks.fallbackIndices[snapshotIndex];
+    return true;
+}
+
+// Rebuilds one row from the column views
+static bool readSnapshotRow(const SnapshotColumnView views[], uint64_t row, Transaction& trans) {
+    const SnapshotColumnView& fallbacks = views[SNAPSHOT_FALLBACK_COLUMN];
+
+    for (int column = 0; column < SNAPSHOT_COLUMN_COUNT; column++) {
+        const SnapshotColumnView& view = views[column];
+
+        switch (SNAPSHOT_COLUMN_KINDS[column]) {
+            case SNAPSHOT_STRING: {
+                uint64_t start = view.rowOffsets[row];
+                uint64_t end = view.rowOffsets[row + 1];
+                if (start > end || end > view.rowBytesLength) return false;
+                trans.timestamp.assign(view.rowBytes + start, end - start);
+                break;
+            }
+            case SNAPSHOT_U64: {
+                PrefixedKey key = ((const uint64_t*)view.data)[row];
+                if (key & PREFIXED_KEY_FALLBACK) {
+                    uint32_t runIndex;
+                    if (!restoreFallback(fallbacks, key & ~PREFIXED_KEY_FALLBACK, runIndex)) return false;
+                    key = PREFIXED_KEY_FALLBACK | runIndex;
+                }
+                *keyColumn(trans, column) = key;
+                break;
+            }
+            case SNAPSHOT_IP: {
+                const uint32_t* words = (const uint32_t*)view.data + row * 2;
+                trans.ip_address.address = words[0];
+                trans.ip_address.fallback = words[1];
+                if (words[1] != IP_ADDRESS_NUMERIC && !restoreFallback(fallbacks, words[1], trans.ip_address.fallback)) return false;
+                break;
+            }
+            case SNAPSHOT_HASH128: {
+                const uint64_t* words = (const uint64_t*)view.data + row * 2;
+                trans.device_hash.words[0] = words[0];
+                trans.device_hash.words[1] = words[1];
+                if (isFallbackDeviceHash(trans.device_hash)) {
+                    uint32_t runIndex;
+                    if (!restoreFallback(fallbacks, words[1], runIndex)) return false;
+                    trans.device_hash.words[1] = runIndex;
+                }
+                break;
+            }
+            case SNAPSHOT_I64:
+                trans.timestamp_ns = ((const int64_t*)view.data)[row];
+                break;
+            case SNAPSHOT_TEXT_TABLE:
+                break;  // interned once in openColumnViews
+            case SNAPSHOT_DICT: {
+                uint32_t code = view.codes[row];
+                if (code >= view.entryCount) return false;
+                *categoryColumn(trans, column) = view.tableCodes[code];
+                break;
+            }
+            case SNAPSHOT_F64:
+                *doubleColumn(trans, column) = ((const double*)view.data)[row];
+                break;
+            case SNAPSHOT_I32:
+                trans.velocity_score = ((const int32_t*)view.data)[row];
+                break;
+            case SNAPSHOT_BOOL:
+                trans.is_fraud = ((const uint8_t*)view.data)[row] != 0;
+                break;
+        }
+    }
+    return true;
+}
+
+// Rows were written in master store order; appending them in that order through
+// partitionFor rebuilds the channels exactly as the CSV loader would.
+static bool loadSnapshotInto(const string& snapshotPath, ChannelArray& store) {
+    MappedFile input;
+    if (!input.open(snapshotPath)) return false;
+
+    const SnapshotHeader* header = nullptr;
+    SnapshotColumnView views[SNAPSHOT_COLUMN_COUNT] = {};
+    if (!validateSnapshot(input, header) || !openColumnViews(input.data(), header, views)) {
+        closeColumnViews(views);
+        cout << "Warning: " << snapshotPath << " is damaged, ignoring it." << endl;
+        return false;
+    }
+
+    store.clear();
+    Transaction trans;
+
+    for (uint64_t row = 0; row < header->rowCount; row++) {
+        if (!readSnapshotRow(views, row, trans)) {
+            cout << "Warning: " << snapshotPath << " is damaged, ignoring it." << endl;
+            closeColumnViews(views);
+            store.clear();
+            return false;
+        }
+
+        store.add(store.partitionFor(trans), move(trans));
+    }
+
+    closeColumnViews(views);
+    return true;
+}
+
+bool loadSnapshot(const string& snapshotPath, ChannelArray& channelArrays) {
+    cout << "\n=== Array Load from Snapshot ===" << endl;
+    auto startTime = high_resolution_clock::now();
+
+    if (!loadSnapshotInto(snapshotPath, channelArrays)) return false;
+
+    auto duration = duration_cast<milliseconds>(high_resolution_clock::now() - startTime);
+    cout << "Restored " << channelArrays.getChannelCount() << " channels from " << snapshotPath
+         << " in " << duration.count() << " ms" << endl;
+    return true;
+}
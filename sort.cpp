@@ -1,62 +1,71 @@
 #include "fileManager.h"
 
 // ============= MERGE SORT (ARRAYS) =============
+// Array sorts run over hot records and move the full records once at the end
 void mergeSortIterative(DynamicArray& arr) {
-    int n = arr.getSize();
+    size_t n = arr.getSize();
     if (n <= 1) return;
 
-    Transaction* temp = new Transaction[n];
-    for (int size = 1; size < n; size *= 2) {
-        for (int left = 0; left < n - 1; left += 2 * size) {
-            int mid = minInt(left + size - 1, n - 1);
-            int right = minInt(left + 2 * size - 1, n - 1);
+    HotTransaction* hot = buildHotRecords(arr);
+    HotTransaction* temp = new HotTransaction[n];
+    for (size_t size = 1; size < n; size *= 2) {
+        for (size_t left = 0; left < n - 1; left += 2 * size) {
+            size_t mid = minSize(left + size - 1, n - 1);
+            size_t right = minSize(left + 2 * size - 1, n - 1);
 
             if (mid < right) {
-                int i = left, j = mid + 1, k = left;
+                size_t i = left, j = mid + 1, k = left;
 
-                for (int x = left; x <= mid; x++) temp[x] = arr[x];
+                for (size_t x = left; x <= mid; x++) temp[x] = hot[x];
 
                 while (i <= mid && j <= right) {
-                    if (fastLocationCompare(temp[i], arr[j])) {
-                        arr[k++] = temp[i++];
+                    if (!fastLocationCompare(hot[j], temp[i])) {
+                        hot[k++] = temp[i++];
                     } else {
-                        arr[k++] = arr[j++];
+                        hot[k++] = hot[j++];
                     }
                 }
-                while (i <= mid) arr[k++] = temp[i++];
+                while (i <= mid) hot[k++] = temp[i++];
             }
         }
     }
     delete[] temp;
+
+    applyHotOrder(arr, hot);
+    delete[] hot;
 }
 
 void mergeSortIterativeByTransactionType(DynamicArray& arr) {
-    int n = arr.getSize();
+    size_t n = arr.getSize();
     if (n <= 1) return;
 
-    Transaction* temp = new Transaction[n];
-    for (int size = 1; size < n; size *= 2) {
-        for (int left = 0; left < n - 1; left += 2 * size) {
-            int mid = minInt(left + size - 1, n - 1);
-            int right = minInt(left + 2 * size - 1, n - 1);
+    HotTransaction* hot = buildHotRecords(arr);
+    HotTransaction* temp = new HotTransaction[n];
+    for (size_t size = 1; size < n; size *= 2) {
+        for (size_t left = 0; left < n - 1; left += 2 * size) {
+            size_t mid = minSize(left + size - 1, n - 1);
+            size_t right = minSize(left + 2 * size - 1, n - 1);
 
             if (mid < right) {
-                int i = left, j = mid + 1, k = left;
+                size_t i = left, j = mid + 1, k = left;
 
-                for (int x = left; x <= mid; x++) temp[x] = arr[x];
+                for (size_t x = left; x <= mid; x++) temp[x] = hot[x];
 
                 while (i <= mid && j <= right) {
-                    if (fastTypeCompare(temp[i], arr[j])) {
-                        arr[k++] = temp[i++];
+                    if (!fastTypeCompare(hot[j], temp[i])) {
+                        hot[k++] = temp[i++];
                     } else {
-                        arr[k++] = arr[j++];
+                        hot[k++] = hot[j++];
                     }
                 }
-                while (i <= mid) arr[k++] = temp[i++];
+                while (i <= mid) hot[k++] = temp[i++];
             }
         }
     }
     delete[] temp;
+
+    applyHotOrder(arr, hot);
+    delete[] hot;
 }
 
 // ============= MERGE SORT (LINKED LISTS) =============
@@ -68,32 +77,22 @@ void mergeSortLLSafeByTransactionType(SinglyLinkedList& list) {
     convertListToArrayAndSort(list, mergeSortArrayByType);
 }
 
-// ============= QUICK SORT (ARRAYS) =============
-static int partition(DynamicArray& arr, int low, int high) {
-    Transaction pivot = arr[high];
-    int i = low - 1;
-
-    for (int j = low; j < high; j++) {
-        if (fastLocationCompare(arr[j], pivot)) {
-            i++;
-            swapTransactions(arr[i], arr[j]);
-        }
-    }
-    swapTransactions(arr[i + 1], arr[high]);
-    return i + 1;
+// ============= MERGE SORT (UNROLLED LISTS) =============
+void mergeSortLLSafe(UnrolledLinkedList& list) {
+    convertListToArrayAndSort(list, mergeSortArrayByLocation);
 }
 
-static void quickSortHelper(DynamicArray& arr, int low, int high) {
-    if (low < high) {
-        int pi = partition(arr, low, high);
-        quickSortHelper(arr, low, pi - 1);
-        quickSortHelper(arr, pi + 1, high);
-    }
+void mergeSortLLSafeByTransactionType(UnrolledLinkedList& list) {
+    convertListToArrayAndSort(list, mergeSortArrayByType);
 }
 
+// ============= QUICK SORT (ARRAYS) =============
 void quickSort(DynamicArray& arr) {
     if (arr.getSize() > 1) {
-        quickSortHelper(arr, 0, arr.getSize() - 1);
+        HotTransaction* hot = buildHotRecords(arr);
+        quickSortArray(hot, arr.getSize());
+        applyHotOrder(arr, hot);
+        delete[] hot;
     }
 }
 
@@ -102,12 +101,16 @@ void quickSortLL(SinglyLinkedList& list) {
     convertListToArrayAndSort(list, quickSortArray);
 }
 
+void quickSortLL(UnrolledLinkedList& list) {
+    convertListToArrayAndSort(list, quickSortArray);
+}
+
 // ============= HEAP SORT (ARRAYS) =============
-static void heapify(DynamicArray& arr, int n, int i) {
+static void heapify(HotTransaction* arr, size_t n, size_t i) {
     while (true) {
-        int largest = i;
-        int left = 2 * i + 1;
-        int right = 2 * i + 2;
+        size_t largest = i;
+        size_t left = 2 * i + 1;
+        size_t right = 2 * i + 2;
 
         if (left < n && !fastLocationCompare(arr[left], arr[largest])) largest = left;
         if (right < n && !fastLocationCompare(arr[right], arr[largest])) largest = right;
@@ -120,18 +123,539 @@ static void heapify(DynamicArray& arr, int n, int i) {
 }
 
 void heapSort(DynamicArray& arr) {
-    int n = arr.getSize();
+    size_t n = arr.getSize();
     if (n <= 1) return;
 
-    for (int i = n / 2 - 1; i >= 0; i--) heapify(arr, n, i);
+    HotTransaction* hot = buildHotRecords(arr);
+    for (size_t i = n / 2; i-- > 0;) heapify(hot, n, i);
 
-    for (int i = n - 1; i > 0; i--) {
-        swapTransactions(arr[0], arr[i]);
-        heapify(arr, i, 0);
+    for (size_t i = n - 1; i > 0; i--) {
+        swapTransactions(hot[0], hot[i]);
+        heapify(hot, i, 0);
     }
+
+    applyHotOrder(arr, hot);
+    delete[] hot;
 }
 
 // ============= HEAP SORT (LINKED LISTS) =============
 void heapSortLL(SinglyLinkedList& list) {
     convertListToArrayAndSort(list, heapSortArray);
 }
+
+void heapSortLL(UnrolledLinkedList& list) {
+    convertListToArrayAndSort(list, heapSortArray);
+}
+
+// ============= COUNTING / RADIX SORT (ARRAYS) =============
+void countingSort(DynamicArray& arr) {
+    if (arr.getSize() > 1) {
+        HotTransaction* hot = buildHotRecords(arr);
+        countingSortArray(hot, arr.getSize());
+        applyHotOrder(arr, hot);
+        delete[] hot;
+    }
+}
+
+void countingSortByTransactionType(DynamicArray& arr) {
+    if (arr.getSize() > 1) {
+        HotTransaction* hot = buildHotRecords(arr);
+        countingSortArrayByType(hot, arr.getSize());
+        applyHotOrder(arr, hot);
+        delete[] hot;
+    }
+}
+
+void radixSort(DynamicArray& arr) {
+    if (arr.getSize() > 1) {
+        HotTransaction* hot = buildHotRecords(arr);
+        radixSortArray(hot, arr.getSize());
+        applyHotOrder(arr, hot);
+        delete[] hot;
+    }
+}
+
+// ============= COUNTING / RADIX SORT (LINKED LISTS) =============
+void countingSortLL(SinglyLinkedList& list) {
+    convertListToArrayAndSort(list, countingSortArray);
+}
+
+void countingSortLL(UnrolledLinkedList& list) {
+    convertListToArrayAndSort(list, countingSortArray);
+}
+
+void radixSortLL(SinglyLinkedList& list) {
+    convertListToArrayAndSort(list, radixSortArray);
+}
+
+void radixSortLL(UnrolledLinkedList& list) {
+    convertListToArrayAndSort(list, radixSortArray);
+}
+
+// ============= KEYED SORT KERNELS =============
+
+// Each kernel orders a rank array and carries the 32-bit row numbers along with it
+
+static inline void swapKeyed(uint32_t* keys, RowIndex* order, size_t a, size_t b) {
+    swap(keys[a], keys[b]);
+    swap(order[a], order[b]);
+}
+
+// Same passes as mergeSortIterative, so rows with equal keys keep their order
+static void mergeSortKeyed(uint32_t* keys, RowIndex* order, size_t n) {
+    uint32_t* tempKeys = new uint32_t[n];
+    RowIndex* tempOrder = new RowIndex[n];
+
+    for (size_t size = 1; size < n; size *= 2) {
+        for (size_t left = 0; left < n - 1; left += 2 * size) {
+            size_t mid = minSize(left + size - 1, n - 1);
+            size_t right = minSize(left + 2 * size - 1, n - 1);
+
+            if (mid < right) {
+                size_t i = left, j = mid + 1, k = left;
+
+                for (size_t x = left; x <= mid; x++) {
+                    tempKeys[x] = keys[x];
+                    tempOrder[x] = order[x];
+                }
+
+                while (i <= mid && j <= right) {
+                    if (!(keys[j] < tempKeys[i])) {
+                        keys[k] = tempKeys[i];
+                        order[k++] = tempOrder[i++];
+                    } else {
+                        keys[k] = keys[j];
+                        order[k++] = order[j++];
+                    }
+                }
+                while (i <= mid) {
+                    keys[k] = tempKeys[i];
+                    order[k++] = tempOrder[i++];
+                }
+            }
+        }
+    }
+
+    delete[] tempKeys;
+    delete[] tempOrder;
+}
+
+// Key and row side by side, so the introsort engine moves one 8-byte value per swap
+struct KeyedRow {
+    uint32_t key;
+    RowIndex row;
+};
+
+static KeyedRow* packKeyedRows(const uint32_t* keys, const RowIndex* order, size_t n) {
+    KeyedRow* pairs = new KeyedRow[n];
+    for (size_t i = 0; i < n; i++) {
+        pairs[i].key = keys[i];
+        pairs[i].row = order[i];
+    }
+    return pairs;
+}
+
+static void unpackKeyedRows(KeyedRow* pairs, uint32_t* keys, RowIndex* order, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = pairs[i].key;
+        order[i] = pairs[i].row;
+    }
+    delete[] pairs;
+}
+
+// Same engine as quickSortArray
+static void quickSortKeyed(uint32_t* keys, RowIndex* order, size_t n) {
+    KeyedRow* pairs = packKeyedRows(keys, order, n);
+    introSort(pairs, n, [](const KeyedRow& a, const KeyedRow& b) { return a.key < b.key; });
+    unpackKeyedRows(pairs, keys, order, n);
+}
+
+static void heapifyKeyed(uint32_t* keys, RowIndex* order, size_t n, size_t i) {
+    while (true) {
+        size_t largest = i;
+        size_t left = 2 * i + 1;
+        size_t right = 2 * i + 2;
+
+        if (left < n && !(keys[left] < keys[largest])) largest = left;
+        if (right < n && !(keys[right] < keys[largest])) largest = right;
+
+        if (largest == i) break;
+
+        swapKeyed(keys, order, i, largest);
+        i = largest;
+    }
+}
+
+static void heapSortKeyed(uint32_t* keys, RowIndex* order, size_t n) {
+    for (size_t i = n / 2; i-- > 0;) heapifyKeyed(keys, order, n, i);
+
+    for (size_t i = n - 1; i > 0; i--) {
+        swapKeyed(keys, order, 0, i);
+        heapifyKeyed(keys, order, i, 0);
+    }
+}
+
+// Stable, in O(n + distinct keys)
+static void countingSortKeyed(uint32_t* keys, RowIndex* order, size_t n) {
+    uint32_t maxKey = 0;
+    for (size_t i = 0; i < n; i++) maxKey = (keys[i] > maxKey) ? keys[i] : maxKey;
+
+    KeyedRow* pairs = packKeyedRows(keys, order, n);
+    countingSortBy(pairs, n, (size_t)maxKey + 1, [](const KeyedRow& p) { return (size_t)p.key; });
+    unpackKeyedRows(pairs, keys, order, n);
+}
+
+// ============= PARALLEL MERGE SORT =============
+
+// Below this many pairs per thread the thread start-up costs more than it saves
+const size_t PARALLEL_SORT_MIN_BLOCK = 16384;
+
+static int getSortThreadCount(size_t n) {
+    int threadCount = (int)thread::hardware_concurrency();
+    if (threadCount < 1) threadCount = 1;
+
+    size_t maxUseful = n / PARALLEL_SORT_MIN_BLOCK;
+    if ((size_t)threadCount > maxUseful) threadCount = (maxUseful > 0) ? (int)maxUseful : 1;
+    return threadCount;
+}
+
+// Stable bottom-up merge sort of one block; buffer is scratch of the same length
+static void mergeSortPairs(KeyedRow* pairs, KeyedRow* buffer, size_t n) {
+    KeyedRow* src = pairs;
+    KeyedRow* dst = buffer;
+
+    for (size_t width = 1; width < n; width *= 2) {
+        for (size_t left = 0; left < n; left += 2 * width) {
+            size_t mid = minSize(left + width, n);
+            size_t right = minSize(left + 2 * width, n);
+            size_t i = left, j = mid, k = left;
+
+            while (i < mid && j < right) {
+                dst[k++] = (src[j].key < src[i].key) ? src[j++] : src[i++];
+            }
+            while (i < mid) dst[k++] = src[i++];
+            while (j < right) dst[k++] = src[j++];
+        }
+        swap(src, dst);
+    }
+
+    if (src != pairs) {
+        for (size_t i = 0; i < n; i++) pairs[i] = src[i];
+    }
+}
+
+// Merge path: how many of the first diagonal outputs of merging a and b come from a.
+// Ties go to a, which keeps the merge stable.
+static size_t mergePathSplit(const KeyedRow* a, size_t aLength, const KeyedRow* b, size_t bLength, size_t diagonal) {
+    size_t low = (diagonal > bLength) ? diagonal - bLength : 0;
+    size_t high = minSize(diagonal, aLength);
+
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (!(b[diagonal - mid - 1].key < a[mid].key)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// Writes dst[outBegin, outEnd) of the merge of src[runStart, mid) and src[mid, runEnd)
+static void mergeOutputRange(const KeyedRow* src, KeyedRow* dst, size_t runStart, size_t mid, size_t runEnd,
+                             size_t outBegin, size_t outEnd) {
+    const KeyedRow* a = src + runStart;
+    const KeyedRow* b = src + mid;
+    size_t aLength = mid - runStart;
+    size_t bLength = runEnd - mid;
+
+    size_t i = mergePathSplit(a, aLength, b, bLength, outBegin - runStart);
+    size_t j = (outBegin - runStart) - i;
+
+    for (size_t k = outBegin; k < outEnd; k++) {
+        if (j >= bLength || (i < aLength && !(b[j].key < a[i].key))) {
+            dst[k] = a[i++];
+        } else {
+            dst[k] = b[j++];
+        }
+    }
+}
+
+// One merge round: runs of width are merged in pairs, and each thread takes an
+// equal slice of the output whichever pairs it falls in
+static void mergeRoundSlice(const KeyedRow* src, KeyedRow* dst, size_t n, size_t width, size_t outBegin, size_t outEnd) {
+    while (outBegin < outEnd) {
+        size_t runStart = (outBegin / (2 * width)) * (2 * width);
+        size_t mid = minSize(runStart + width, n);
+        size_t runEnd = minSize(runStart + 2 * width, n);
+        size_t sliceEnd = minSize(outEnd, runEnd);
+
+        mergeOutputRange(src, dst, runStart, mid, runEnd, outBegin, sliceEnd);
+        outBegin = sliceEnd;
+    }
+}
+
+// Each thread sorts one block, then log2(threads) rounds of merge-path merges
+// use every thread for every round
+static void parallelMergeSortPairs(KeyedRow* pairs, size_t n) {
+    KeyedRow* buffer = new KeyedRow[n];
+    int threadCount = getSortThreadCount(n);
+
+    if (threadCount == 1) {
+        mergeSortPairs(pairs, buffer, n);
+        delete[] buffer;
+        return;
+    }
+
+    size_t blockSize = (n + threadCount - 1) / threadCount;
+    thread* workers = new thread[threadCount];
+
+    for (int t = 0; t < threadCount; t++) {
+        size_t begin = minSize((size_t)t * blockSize, n);
+        size_t end = minSize(begin + blockSize, n);
+        workers[t] = thread(mergeSortPairs, pairs + begin, buffer + begin, end - begin);
+    }
+    for (int t = 0; t < threadCount; t++) workers[t].join();
+
+    KeyedRow* src = pairs;
+    KeyedRow* dst = buffer;
+    for (size_t width = blockSize; width < n; width *= 2) {
+        for (int t = 0; t < threadCount; t++) {
+            size_t outBegin = n * t / threadCount;
+            size_t outEnd = n * (t + 1) / threadCount;
+            workers[t] = thread(mergeRoundSlice, src, dst, n, width, outBegin, outEnd);
+        }
+        for (int t = 0; t < threadCount; t++) workers[t].join();
+        swap(src, dst);
+    }
+
+    if (src != pairs) {
+        for (size_t i = 0; i < n; i++) pairs[i] = src[i];
+    }
+
+    delete[] workers;
+    delete[] buffer;
+}
+
+// Same order as mergeSortKeyed
+static void parallelMergeSortKeyed(uint32_t* keys, RowIndex* order, size_t n) {
+    KeyedRow* pairs = packKeyedRows(keys, order, n);
+    parallelMergeSortPairs(pairs, n);
+    unpackKeyedRows(pairs, keys, order, n);
+}
+
+// ============= SORTS (ROW INDICES) =============
+
+static uint32_t* buildSortKeys(const ChannelView& view, CategoryColumn column) {
+    size_t n = view.getSize();
+    uint32_t* keys = new uint32_t[n];
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = categoryTable.rank(column, categoryCodeOf(view[i], column));
+    }
+    return keys;
+}
+
+static void copyViewRows(const ChannelView& view, IndexVector& sortedRows) {
+    const IndexVector& rows = view.getRows();
+    sortedRows.clear();
+    sortedRows.reserve(rows.getSize());
+    for (size_t i = 0; i < rows.getSize(); i++) sortedRows.push_back(rows[i]);
+}
+
+// sortedRows starts as the view's own rows and is reordered in place by the keyed
+// kernels, so no record is copied or swapped
+static void sortRowsBy(const ChannelView& view, IndexVector& sortedRows, CategoryColumn column,
+                       void (*sortKeyed)(uint32_t*, RowIndex*, size_t)) {
+    size_t n = view.getSize();
+    copyViewRows(view, sortedRows);
+    if (n <= 1) return;
+
+    uint32_t* keys = buildSortKeys(view, column);
+    sortKeyed(keys, sortedRows.data(), n);
+    delete[] keys;
+}
+
+void mergeSortRows(const ChannelView& view, IndexVector& sortedRows) {
+    sortRowsBy(view, sortedRows, CATEGORY_LOCATION, mergeSortKeyed);
+}
+
+void mergeSortRowsByTransactionType(const ChannelView& view, IndexVector& sortedRows) {
+    sortRowsBy(view, sortedRows, CATEGORY_TRANSACTION_TYPE, mergeSortKeyed);
+}
+
+void quickSortRows(const ChannelView& view, IndexVector& sortedRows) {
+    sortRowsBy(view, sortedRows, CATEGORY_LOCATION, quickSortKeyed);
+}
+
+void heapSortRows(const ChannelView& view, IndexVector& sortedRows) {
+    sortRowsBy(view, sortedRows, CATEGORY_LOCATION, heapSortKeyed);
+}
+
+void countingSortRows(const ChannelView& view, IndexVector& sortedRows) {
+    sortRowsBy(view, sortedRows, CATEGORY_LOCATION, countingSortKeyed);
+}
+
+void countingSortRowsByTransactionType(const ChannelView& view, IndexVector& sortedRows) {
+    sortRowsBy(view, sortedRows, CATEGORY_TRANSACTION_TYPE, countingSortKeyed);
+}
+
+void parallelMergeSortRows(const ChannelView& view, IndexVector& sortedRows) {
+    sortRowsBy(view, sortedRows, CATEGORY_LOCATION, parallelMergeSortKeyed);
+}
+
+void parallelMergeSortRowsByTransactionType(const ChannelView& view, IndexVector& sortedRows) {
+    sortRowsBy(view, sortedRows, CATEGORY_TRANSACTION_TYPE, parallelMergeSortKeyed);
+}
+
+// Radix keys are the location text, read through the row index
+void radixSortRows(const ChannelView& view, IndexVector& sortedRows) {
+    copyViewRows(view, sortedRows);
+
+    const DynamicArray& records = view.getRecords();
+    msdRadixSort(sortedRows.data(), sortedRows.getSize(),
+                 [&records](RowIndex row) -> const string& { return categoryName(CATEGORY_LOCATION, records[row].location); });
+}
+
+// The optional gather: one copy per record, in the order of the view
+void gatherRows(const ChannelView& sortedView, DynamicArray& arr) {
+    arr.clear();
+    arr.reserve(sortedView.getSize());
+    for (size_t i = 0; i < sortedView.getSize(); i++) {
+        arr.push_back(sortedView[i]);
+    }
+}
+
+// ============= SORTS (COLUMNAR STORE) =============
+
+// Ranks of the sort column; the kernels only ever touch keys and 32-bit row numbers
+static uint32_t* buildSortKeys(const TransactionStore& store, CategoryColumn column) {
+    size_t n = store.getSize();
+    const CategoryCode* codes = (column == CATEGORY_LOCATION) ? store.locationColumn() : store.transactionTypeColumn();
+
+    uint32_t* keys = new uint32_t[n];
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = categoryTable.rank(column, codes[i]);
+    }
+    return keys;
+}
+
+static RowIndex* buildIdentityOrder(size_t n) {
+    RowIndex* order = new RowIndex[n];
+    for (size_t i = 0; i < n; i++) order[i] = (RowIndex)i;
+    return order;
+}
+
+// Sorts (key, row) pairs, then gathers each column once in the sorted order
+static void sortStoreBy(TransactionStore& store, CategoryColumn column,
+                        void (*sortKeyed)(uint32_t*, RowIndex*, size_t)) {
+    size_t n = store.getSize();
+    if (n <= 1) return;
+
+    uint32_t* keys = buildSortKeys(store, column);
+    RowIndex* order = buildIdentityOrder(n);
+
+    sortKeyed(keys, order, n);
+    store.permute(order);
+
+    delete[] keys;
+    delete[] order;
+}
+
+void mergeSortIterative(TransactionStore& store) {
+    sortStoreBy(store, CATEGORY_LOCATION, mergeSortKeyed);
+}
+
+void mergeSortIterativeByTransactionType(TransactionStore& store) {
+    sortStoreBy(store, CATEGORY_TRANSACTION_TYPE, mergeSortKeyed);
+}
+
+void quickSort(TransactionStore& store) {
+    sortStoreBy(store, CATEGORY_LOCATION, quickSortKeyed);
+}
+
+void heapSort(TransactionStore& store) {
+    sortStoreBy(store, CATEGORY_LOCATION, heapSortKeyed);
+}
+
+void countingSort(TransactionStore& store) {
+    sortStoreBy(store, CATEGORY_LOCATION, countingSortKeyed);
+}
+
+void parallelMergeSort(TransactionStore& store) {
+    sortStoreBy(store, CATEGORY_LOCATION, parallelMergeSortKeyed);
+}
+
+void parallelMergeSortByTransactionType(TransactionStore& store) {
+    sortStoreBy(store, CATEGORY_TRANSACTION_TYPE, parallelMergeSortKeyed);
+}
+
+// Radix keys are the location text, read through the location column
+void radixSort(TransactionStore& store) {
+    size_t n = store.getSize();
+    if (n <= 1) return;
+
+    RowIndex* order = buildIdentityOrder(n);
+    const CategoryCode* locations = store.locationColumn();
+    msdRadixSort(order, n,
+                 [locations](RowIndex row) -> const string& { return categoryName(CATEGORY_LOCATION, locations[row]); });
+    store.permute(order);
+
+    delete[] order;
+}
+
+// ============= PARALLEL MERGE SORT (ARRAYS AND LISTS) =============
+
+// Sorts the (rank, position) pairs of the hot records, then puts the records in that order
+static void parallelMergeSortHot(HotTransaction* arr, size_t n, CategoryColumn column) {
+    if (n <= 1) return;
+
+    KeyedRow* pairs = new KeyedRow[n];
+    for (size_t i = 0; i < n; i++) {
+        CategoryCode code = (column == CATEGORY_LOCATION) ? arr[i].location : arr[i].transaction_type;
+        pairs[i].key = categoryTable.rank(column, code);
+        pairs[i].row = (RowIndex)i;
+    }
+
+    parallelMergeSortPairs(pairs, n);
+
+    HotTransaction* sorted = new HotTransaction[n];
+    for (size_t i = 0; i < n; i++) sorted[i] = arr[pairs[i].row];
+    for (size_t i = 0; i < n; i++) arr[i] = sorted[i];
+
+    delete[] sorted;
+    delete[] pairs;
+}
+
+void parallelMergeSortArray(HotTransaction* arr, size_t n) {
+    parallelMergeSortHot(arr, n, CATEGORY_LOCATION);
+}
+
+void parallelMergeSortArrayByType(HotTransaction* arr, size_t n) {
+    parallelMergeSortHot(arr, n, CATEGORY_TRANSACTION_TYPE);
+}
+
+void parallelMergeSort(DynamicArray& arr) {
+    if (arr.getSize() > 1) {
+        HotTransaction* hot = buildHotRecords(arr);
+        parallelMergeSortArray(hot, arr.getSize());
+        applyHotOrder(arr, hot);
+        delete[] hot;
+    }
+}
+
+void parallelMergeSortByTransactionType(DynamicArray& arr) {
+    if (arr.getSize() > 1) {
+        HotTransaction* hot = buildHotRecords(arr);
+        parallelMergeSortArrayByType(hot, arr.getSize());
+        applyHotOrder(arr, hot);
+        delete[] hot;
+    }
+}
+
+void parallelMergeSortLL(SinglyLinkedList& list) {
+    convertListToArrayAndSort(list, parallelMergeSortArray);
+}
+
+void parallelMergeSortLL(UnrolledLinkedList& list) {
+    convertListToArrayAndSort(list, parallelMergeSortArray);
+}
@@ -0,0 +1,120 @@
+#include "fileManager.h"
+
+// ============= STRING HASHING =============
+
+// FNV-1a, good enough spread for short categorical values
+uint64_t hashString(string_view value) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < value.size(); i++) {
+        hash ^= (unsigned char)value[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// ============= STRING DICTIONARY =============
+
+const int STRING_DICTIONARY_FIRST_BLOCK = 16;
+
+StringDictionary::StringDictionary() {
+    for (int i = 0; i < STRING_DICTIONARY_BLOCKS; i++) blocks[i] = nullptr;
+    entryCount = 0;
+
+    slotCount = 32;
+    slots = new int[slotCount];
+    for (int i = 0; i < slotCount; i++) slots[i] = -1;
+}
+
+StringDictionary::~StringDictionary() {
+    for (int i = 0; i < STRING_DICTIONARY_BLOCKS; i++) delete[] blocks[i];
+    delete[] slots;
+}
+
+// Block b starts at code 16 * (2^b - 1) and holds 16 * 2^b entries
+string& StringDictionary::entryAt(int code) const {
+    int block = 0;
+    int blockStart = 0;
+    int blockSize = STRING_DICTIONARY_FIRST_BLOCK;
+    while (code >= blockStart + blockSize) {
+        blockStart += blockSize;
+        blockSize <<= 1;
+        block++;
+    }
+    return blocks[block][code - blockStart];
+}
+
+// Doubles the open-addressing table and reinserts every code
+void StringDictionary::rehash() {
+    delete[] slots;
+    slotCount *= 2;
+    slots = new int[slotCount];
+    for (int i = 0; i < slotCount; i++) slots[i] = -1;
+
+    for (int code = 0; code < entryCount; code++) {
+        size_t slot = (size_t)hashString(entryAt(code)) & (size_t)(slotCount - 1);
+        while (slots[slot] != -1) {
+            slot = (slot + 1) & (size_t)(slotCount - 1);
+        }
+        slots[slot] = code;
+    }
+}
+
+int StringDictionary::find(string_view value) const {
+    size_t slot = (size_t)hashString(value) & (size_t)(slotCount - 1);
+    while (slots[slot] != -1) {
+        if (entryAt(slots[slot]) == value) {
+            return slots[slot];
+        }
+        slot = (slot + 1) & (size_t)(slotCount - 1);
+    }
+    return -1;
+}
+
+// Returns the code for value, adding it on first sight
+int StringDictionary::intern(string_view value) {
+    size_t slot = (size_t)hashString(value) & (size_t)(slotCount - 1);
+    while (slots[slot] != -1) {
+        if (entryAt(slots[slot]) == value) {
+            return slots[slot];
+        }
+        slot = (slot + 1) & (size_t)(slotCount - 1);
+    }
+
+    // Allocate the next block when the code crosses into it
+    int code = entryCount;
+    int block = 0;
+    int blockStart = 0;
+    int blockSize = STRING_DICTIONARY_FIRST_BLOCK;
+    while (code >= blockStart + blockSize) {
+        blockStart += blockSize;
+        blockSize <<= 1;
+        block++;
+    }
+    if (blocks[block] == nullptr) {
+        blocks[block] = new string[blockSize];
+    }
+
+    blocks[block][code - blockStart].assign(value.data(), value.size());
+    slots[slot] = code;
+    entryCount++;
+
+    // Keep the load factor under one half
+    if (entryCount * 2 > slotCount) {
+        rehash();
+    }
+    return code;
+}
+
+const string& StringDictionary::lookup(int code) const {
+    return entryAt(code);
+}
+
+int StringDictionary::size() const {
+    return entryCount;
+}
+
+void StringDictionary::clear() {
+    for (int code = 0; code < entryCount; code++) entryAt(code).clear();
+    for (int i = 0; i < slotCount; i++) slots[i] = -1;
+    entryCount = 0;
+}
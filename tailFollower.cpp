@@ -0,0 +1,171 @@
+#include "fileManager.h"
+#include <atomic>
+#include <filesystem>
+
+// ============= TAIL FOLLOWER =============
+
+TailFollower::TailFollower(const string& filename, bool fromBeginning)
+    : filename(filename), offset(0), skipFirstLine(true), loadedCount(0), skippedCount(0) {
+    if (fromBeginning) {
+        return;
+    }
+
+    // Start at the current end; only a line cut in half needs skipping
+    error_code error;
+    uintmax_t size = filesystem::file_size(filename, error);
+    if (error || size == 0) {
+        return;
+    }
+
+    offset = (uint64_t)size;
+    skipFirstLine = false;
+
+    ifstream inFile(filename, ios::binary);
+    char lastByte = '\n';
+    if (inFile.seekg((streamoff)(size - 1)) && inFile.get(lastByte) && lastByte != '\n') {
+        skipFirstLine = true;
+    }
+}
+
+// Parses every complete line appended since the last poll.
+// Returns the number of rows added, or -1 if the file cannot be read.
+int TailFollower::poll(ChannelArray& channelArrays) {
+    error_code error;
+    uintmax_t size = filesystem::file_size(filename, error);
+    if (error) {
+        return -1;
+    }
+
+    // Truncated or replaced: the feed starts over, header included
+    if ((uint64_t)size < offset) {
+        cout << "Feed was truncated, reading it again from the beginning." << endl;
+        offset = 0;
+        pendingLine.clear();
+        skipFirstLine = true;
+    }
+
+    if ((uint64_t)size == offset) {
+        return 0;
+    }
+
+    ifstream inFile(filename, ios::binary);
+    if (!inFile.is_open() || !inFile.seekg((streamoff)offset)) {
+        return -1;
+    }
+
+    // Carried bytes go first so a split line is parsed whole
+    size_t carried = pendingLine.size();
+    size_t appended = (size_t)(size - offset);
+    readBuffer.swap(pendingLine);
+    readBuffer.resize(carried + appended);
+    inFile.read(&readBuffer[carried], (streamsize)appended);
+    size_t received = (size_t)inFile.gcount();
+    readBuffer.resize(carried + received);
+    offset += received;
+
+    size_t lastNewline = readBuffer.find_last_of('\n');
+    if (lastNewline == string::npos) {
+        pendingLine.swap(readBuffer);
+        return 0;
+    }
+    pendingLine.assign(readBuffer, lastNewline + 1, string::npos);
+
+    CSVScanner scanner(readBuffer.data(), lastNewline + 1);
+    string_view line;
+    int added = 0;
+
+    while (scanner.nextLine(line)) {
+        if (skipFirstLine) {
+            skipFirstLine = false;
+            continue;
+        }
+        if (line.empty()) continue;
+
+        try {
+            if (storeTransactionLine(line, channelArrays, parseStats)) {
+                added++;
+            } else {
+                skippedCount++;
+            }
+        } catch (const length_error&) {
+            parseStats.storeFullRows++;
+            skippedCount++;
+        } catch (...) {
+            skippedCount++;
+        }
+    }
+
+    loadedCount += added;
+    return added;
+}
+
+uint64_t TailFollower::getOffset() const {
+    return offset;
+}
+
+long long TailFollower::getLoadedCount() const {
+    return loadedCount;
+}
+
+long long TailFollower::getSkippedCount() const {
+    return skippedCount;
+}
+
+const ParseStats& TailFollower::getParseStats() const {
+    return parseStats;
+}
+
+// ============= FOLLOW MENU OPTION =============
+
+// Polls the feed until Enter is pressed. Returns true if any rows were added.
+bool followTransactionFeed(ChannelArray& channelArrays) {
+    cout << "\n=== FOLLOW LIVE TRANSACTION FEED ===" << endl;
+    cout << "Enter CSV file path: ";
+
+    string feedPath = getWindowsPath();
+    if (!fileExists(feedPath)) {
+        cout << "Error: File not found." << endl;
+        return false;
+    }
+
+    cout << "Start from (1=Beginning of file, 2=Only new rows): ";
+    bool fromBeginning = (getSafeIntegerInput(1, 2) == 1);
+
+    TailFollower follower(feedPath, fromBeginning);
+
+    cout << "Following " << feedPath << " (checking every " << TAIL_POLL_INTERVAL_MS << " ms)." << endl;
+    cout << "Press Enter to stop." << endl;
+
+    // Console input blocks, so a separate thread waits for Enter
+    atomic<bool> stopRequested(false);
+    thread stopWatcher([&stopRequested]() {
+        cin.get();
+        stopRequested = true;
+    });
+
+    while (!stopRequested) {
+        int added = follower.poll(channelArrays);
+        if (added < 0) {
+            cout << "Error: Cannot read " << feedPath << ". Press Enter to stop." << endl;
+            break;
+        }
+        if (added > 0) {
+            cout << "+" << added << " transactions (" << follower.getLoadedCount() << " total, offset "
+                 << follower.getOffset() << ")" << endl;
+        }
+
+        for (int waited = 0; waited < TAIL_POLL_INTERVAL_MS && !stopRequested; waited += 50) {
+            this_thread::sleep_for(milliseconds(50));
+        }
+    }
+    stopWatcher.join();
+
+    cout << "\nFollowed feed: " << follower.getLoadedCount() << " transactions added" << endl;
+    if (follower.getSkippedCount() > 0) {
+        cout << "Skipped due to errors: " << follower.getSkippedCount() << " transactions" << endl;
+    }
+    displayParseStats(follower.getParseStats());
+    displayChannelSeparation(channelArrays);
+
+    return follower.getLoadedCount() > 0;
+}
@@ -0,0 +1,54 @@
+// DynamicArray capacity checks for clear() and shrink_to_fit().
+// Build from the repository root and run; exits non-zero on the first failure:
+//   g++ -std=c++17 -pthread -I. -o dynamicArrayTest tests/dynamicArrayTest.cpp $(ls *.cpp | grep -v '^main.cpp$')
+#include "fileManager.h"
+
+static int failures = 0;
+
+static void check(bool condition, const char* what) {
+    if (!condition) {
+        cout << "FAILED: " << what << endl;
+        failures++;
+    }
+}
+
+static void fill(DynamicArray& arr, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        Transaction trans;
+        trans.amount = (double)i;
+        trans.timestamp = "row " + to_string(i);
+        arr.push_back(move(trans));
+    }
+}
+
+int main() {
+    DynamicArray arr;
+    fill(arr, 3 * TRANSACTION_SEGMENT_SIZE - 10);
+    check(arr.getCapacity() == 3 * TRANSACTION_SEGMENT_SIZE, "three segments after filling");
+
+    // clear() keeps the segments for reuse; shrink_to_fit() then hands them all back
+    size_t liveBeforeShrink = getLiveAllocatedBytes();
+    arr.clear();
+    check(arr.getSize() == 0, "clear empties the array");
+    check(arr.getCapacity() == 3 * TRANSACTION_SEGMENT_SIZE, "clear keeps the segments");
+    arr.shrink_to_fit();
+    check(arr.getCapacity() == 0, "shrink_to_fit after clear frees every segment");
+    check(getLiveAllocatedBytes() < liveBeforeShrink, "shrink_to_fit releases memory");
+
+    // Trailing empty segments go, the partly filled last one stays
+    fill(arr, TRANSACTION_SEGMENT_SIZE + 1);
+    arr.reserve(5 * TRANSACTION_SEGMENT_SIZE);
+    check(arr.getCapacity() == 5 * TRANSACTION_SEGMENT_SIZE, "reserve adds segments");
+    arr.shrink_to_fit();
+    check(arr.getCapacity() == 2 * TRANSACTION_SEGMENT_SIZE, "shrink_to_fit keeps only used segments");
+    check(arr.getSize() == TRANSACTION_SEGMENT_SIZE + 1, "shrink_to_fit keeps the records");
+    check(arr[TRANSACTION_SEGMENT_SIZE].timestamp == "row " + to_string(TRANSACTION_SEGMENT_SIZE), "last record intact");
+
+    // A shrunk array still grows
+    fill(arr, TRANSACTION_SEGMENT_SIZE);
+    check(arr.getSize() == 2 * TRANSACTION_SEGMENT_SIZE + 1, "push_back after shrink_to_fit");
+    check(arr[0].amount == 0.0 && arr[arr.getSize() - 1].amount == (double)(TRANSACTION_SEGMENT_SIZE - 1), "records after regrowth");
+
+    if (failures == 0) cout << "dynamicArrayTest: all checks passed" << endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,208 @@
+#include "fileManager.h"
+
+// ============= COLUMNAR TRANSACTION STORE =============
+
+const size_t TRANSACTION_STORE_INITIAL_CAPACITY = 1024;
+
+// Copies the first count values into a column of the new capacity
+template <typename T>
+static T* resizeColumn(T* column, size_t count, size_t newCapacity) {
+    T* resized = new T[newCapacity];
+    for (size_t i = 0; i < count; i++) {
+        resized[i] = move(column[i]);
+    }
+    delete[] column;
+    return resized;
+}
+
+template <typename T>
+static T* gatherColumn(T* column, const RowIndex* order, size_t count, size_t capacity) {
+    T* gathered = new T[capacity];
+    for (size_t i = 0; i < count; i++) {
+        gathered[i] = move(column[order[i]]);
+    }
+    delete[] column;
+    return gathered;
+}
+
+TransactionStore::TransactionStore()
+    : transactionIds(nullptr), timestamps(nullptr), timestampNs(nullptr), senderAccounts(nullptr), receiverAccounts(nullptr),
+      amounts(nullptr), transactionTypes(nullptr), merchantCategories(nullptr), locations(nullptr),
+      devicesUsed(nullptr), fraudFlags(nullptr), fraudTypes(nullptr), timesSinceLast(nullptr),
+      spendingDeviationScores(nullptr), velocityScores(nullptr), geoAnomalyScores(nullptr),
+      paymentChannels(nullptr), ipAddresses(nullptr), deviceHashes(nullptr), size(0), capacity(0) {}
+
+TransactionStore::~TransactionStore() {
+    releaseColumns();
+}
+
+void TransactionStore::releaseColumns() {
+    delete[] transactionIds;
+    delete[] timestamps;
+    delete[] timestampNs;
+    delete[] senderAccounts;
+    delete[] receiverAccounts;
+    delete[] amounts;
+    delete[] transactionTypes;
+    delete[] merchantCategories;
+    delete[] locations;
+    delete[] devicesUsed;
+    delete[] fraudFlags;
+    delete[] fraudTypes;
+    delete[] timesSinceLast;
+    delete[] spendingDeviationScores;
+    delete[] velocityScores;
+    delete[] geoAnomalyScores;
+    delete[] paymentChannels;
+    delete[] ipAddresses;
+    delete[] deviceHashes;
+}
+
+void TransactionStore::grow() {
+    size_t newCapacity = (capacity == 0) ? TRANSACTION_STORE_INITIAL_CAPACITY : capacity * 2;
+
+    transactionIds = resizeColumn(transactionIds, size, newCapacity);
+    timestamps = resizeColumn(timestamps, size, newCapacity);
+    timestampNs = resizeColumn(timestampNs, size, newCapacity);
+    senderAccounts = resizeColumn(senderAccounts, size, newCapacity);
+    receiverAccounts = resizeColumn(receiverAccounts, size, newCapacity);
+    amounts = resizeColumn(amounts, size, newCapacity);
+    transactionTypes = resizeColumn(transactionTypes, size, newCapacity);
+    merchantCategories = resizeColumn(merchantCategories, size, newCapacity);
+    locations = resizeColumn(locations, size, newCapacity);
+    devicesUsed = resizeColumn(devicesUsed, size, newCapacity);
+    fraudFlags = resizeColumn(fraudFlags, size, newCapacity);
+    fraudTypes = resizeColumn(fraudTypes, size, newCapacity);
+    timesSinceLast = resizeColumn(timesSinceLast, size, newCapacity);
+    spendingDeviationScores = resizeColumn(spendingDeviationScores, size, newCapacity);
+    velocityScores = resizeColumn(velocityScores, size, newCapacity);
+    geoAnomalyScores = resizeColumn(geoAnomalyScores, size, newCapacity);
+    paymentChannels = resizeColumn(paymentChannels, size, newCapacity);
+    ipAddresses = resizeColumn(ipAddresses, size, newCapacity);
+    deviceHashes = resizeColumn(deviceHashes, size, newCapacity);
+
+    capacity = newCapacity;
+}
+
+void TransactionStore::push_back(const Transaction& trans) {
+    if (size == capacity) {
+        grow();
+    }
+
+    transactionIds[size] = trans.transaction_id;
+    timestamps[size] = trans.timestamp;
+    timestampNs[size] = trans.timestamp_ns;
+    senderAccounts[size] = trans.sender_account;
+    receiverAccounts[size] = trans.receiver_account;
+    amounts[size] = trans.amount;
+    transactionTypes[size] = trans.transaction_type;
+    merchantCategories[size] = trans.merchant_category;
+    locations[size] = trans.location;
+    devicesUsed[size] = trans.device_used;
+    fraudFlags[size] = trans.is_fraud;
+    fraudTypes[size] = trans.fraud_type;
+    timesSinceLast[size] = trans.time_since_last_transaction;
+    spendingDeviationScores[size] = trans.spending_deviation_score;
+    velocityScores[size] = trans.velocity_score;
+    geoAnomalyScores[size] = trans.geo_anomaly_score;
+    paymentChannels[size] = trans.payment_channel;
+    ipAddresses[size] = trans.ip_address;
+    deviceHashes[size] = trans.device_hash;
+    size++;
+}
+
+void TransactionStore::append(const ChannelView& rows) {
+    for (size_t i = 0; i < rows.getSize(); i++) {
+        push_back(rows[i]);
+    }
+}
+
+void TransactionStore::clear() {
+    size = 0; // Keep the columns for reuse, like DynamicArray
+}
+
+TransactionRow TransactionStore::row(size_t index) const {
+    return TransactionRow(this, index);
+}
+
+Transaction TransactionStore::get(size_t index) const {
+    return row(index).toTransaction();
+}
+
+size_t TransactionStore::getSize() const {
+    return size;
+}
+
+size_t TransactionStore::getCapacity() const {
+    return capacity;
+}
+
+void TransactionStore::permute(const RowIndex* order) {
+    if (size <= 1) return;
+
+    transactionIds = gatherColumn(transactionIds, order, size, capacity);
+    timestamps = gatherColumn(timestamps, order, size, capacity);
+    timestampNs = gatherColumn(timestampNs, order, size, capacity);
+    senderAccounts = gatherColumn(senderAccounts, order, size, capacity);
+    receiverAccounts = gatherColumn(receiverAccounts, order, size, capacity);
+    amounts = gatherColumn(amounts, order, size, capacity);
+    transactionTypes = gatherColumn(transactionTypes, order, size, capacity);
+    merchantCategories = gatherColumn(merchantCategories, order, size, capacity);
+    locations = gatherColumn(locations, order, size, capacity);
+    devicesUsed = gatherColumn(devicesUsed, order, size, capacity);
+    fraudFlags = gatherColumn(fraudFlags, order, size, capacity);
+    fraudTypes = gatherColumn(fraudTypes, order, size, capacity);
+    timesSinceLast = gatherColumn(timesSinceLast, order, size, capacity);
+    spendingDeviationScores = gatherColumn(spendingDeviationScores, order, size, capacity);
+    velocityScores = gatherColumn(velocityScores, order, size, capacity);
+    geoAnomalyScores = gatherColumn(geoAnomalyScores, order, size, capacity);
+    paymentChannels = gatherColumn(paymentChannels, order, size, capacity);
+    ipAddresses = gatherColumn(ipAddresses, order, size, capacity);
+    deviceHashes = gatherColumn(deviceHashes, order, size, capacity);
+}
+
+// ============= ROW VIEW =============
+
+PrefixedKey TransactionRow::transaction_id() const { return store->transactionIds[index]; }
+const string& TransactionRow::timestamp() const { return store->timestamps[index]; }
+int64_t TransactionRow::timestamp_ns() const { return store->timestampNs[index]; }
+PrefixedKey TransactionRow::sender_account() const { return store->senderAccounts[index]; }
+PrefixedKey TransactionRow::receiver_account() const { return store->receiverAccounts[index]; }
+double TransactionRow::amount() const { return store->amounts[index]; }
+CategoryCode TransactionRow::transaction_type() const { return store->transactionTypes[index]; }
+CategoryCode TransactionRow::merchant_category() const { return store->merchantCategories[index]; }
+CategoryCode TransactionRow::location() const { return store->locations[index]; }
+CategoryCode TransactionRow::device_used() const { return store->devicesUsed[index]; }
+bool TransactionRow::is_fraud() const { return store->fraudFlags[index]; }
+CategoryCode TransactionRow::fraud_type() const { return store->fraudTypes[index]; }
+double TransactionRow::time_since_last_transaction() const { return store->timesSinceLast[index]; }
+double TransactionRow::spending_deviation_score() const { return store->spendingDeviationScores[index]; }
+int TransactionRow::velocity_score() const { return store->velocityScores[index]; }
+double TransactionRow::geo_anomaly_score() const { return store->geoAnomalyScores[index]; }
+CategoryCode TransactionRow::payment_channel() const { return store->paymentChannels[index]; }
+IpAddress TransactionRow::ip_address() const { return store->ipAddresses[index]; }
+const DeviceHash& TransactionRow::device_hash() const { return store->deviceHashes[index]; }
+
+Transaction TransactionRow::toTransaction() const {
+    Transaction trans;
+    trans.transaction_id = transaction_id();
+    trans.timestamp = timestamp();
+    trans.timestamp_ns = timestamp_ns();
+    trans.sender_account = sender_account();
+    trans.receiver_account = receiver_account();
+    trans.amount = amount();
+    trans.transaction_type = transaction_type();
+    trans.merchant_category = merchant_category();
+    trans.location = location();
+    trans.device_used = device_used();
+    trans.is_fraud = is_fraud();
+    trans.fraud_type = fraud_type();
+    trans.time_since_last_transaction = time_since_last_transaction();
+    trans.spending_deviation_score = spending_deviation_score();
+    trans.velocity_score = velocity_score();
+    trans.geo_anomaly_score = geo_anomaly_score();
+    trans.payment_channel = payment_channel();
+    trans.ip_address = ip_address();
+    trans.device_hash = device_hash();
+    return trans;
+}
@@ -43,6 +43,12 @@ void swapTransactions(Transaction& a, Transaction& b) {
     b = temp;
 }
 
+void swapTransactions(HotTransaction& a, HotTransaction& b) {
+    HotTransaction temp = a;
+    a = b;
+    b = temp;
+}
+
 // ============= INPUT VALIDATION =============
 
 int getSafeIntegerInput(int min, int max) {
@@ -72,6 +78,28 @@ bool isValidSearchTerm(const string& searchTerm, const string validTypes[], int
     return false;
 }
 
+// Column the master store splits its rows by
+CategoryColumn promptPartitionColumn() {
+    cout << "Partition by (1=Payment channel, 2=Merchant category, 3=Location, 4=Device): ";
+    switch (getSafeIntegerInput(1, 4)) {
+        case 2: return CATEGORY_MERCHANT;
+        case 3: return CATEGORY_LOCATION;
+        case 4: return CATEGORY_DEVICE;
+        default: return CATEGORY_PAYMENT_CHANNEL;
+    }
+}
+
+const char* partitionColumnLabel(CategoryColumn column) {
+    switch (column) {
+        case CATEGORY_TRANSACTION_TYPE: return "TRANSACTION TYPE";
+        case CATEGORY_MERCHANT: return "MERCHANT CATEGORY";
+        case CATEGORY_LOCATION: return "LOCATION";
+        case CATEGORY_DEVICE: return "DEVICE";
+        case CATEGORY_FRAUD_TYPE: return "FRAUD TYPE";
+        default: return "PAYMENT CHANNEL";
+    }
+}
+
 // ============= STRING PROCESSING UTILITIES =============
 
 // Inline character conversion
@@ -90,142 +118,158 @@ int fastStringCompare(const char* str1, const char* str2) {
     return (*str1) - (*str2);
 }
 
+// Ranks follow the same case-insensitive order as fastStringCompare
 bool fastLocationCompare(const Transaction& a, const Transaction& b) {
-    const char* strA = a.location.c_str();
-    const char* strB = b.location.c_str();
-
-    while (*strA && *strB) {
-        char charA = (*strA >= 'A' && *strA <= 'Z') ? *strA + 32 : *strA;
-        char charB = (*strB >= 'A' && *strB <= 'Z') ? *strB + 32 : *strB;
-
-        if (charA != charB) {
-            return charA < charB;
-        }
-        strA++;
-        strB++;
-    }
-    return *strA < *strB;
+    return categoryTable.rank(CATEGORY_LOCATION, a.location) < categoryTable.rank(CATEGORY_LOCATION, b.location);
 }
 
 bool fastTypeCompare(const Transaction& a, const Transaction& b) {
-    const char* strA = a.transaction_type.c_str();
-    const char* strB = b.transaction_type.c_str();
-
-    while (*strA && *strB) {
-        char charA = (*strA >= 'A' && *strA <= 'Z') ? *strA + 32 : *strA;
-        char charB = (*strB >= 'A' && *strB <= 'Z') ? *strB + 32 : *strB;
-
-        if (charA != charB) {
-            return charA < charB;
-        }
-        strA++;
-        strB++;
-    }
-    return *strA < *strB;
+    return categoryTable.rank(CATEGORY_TRANSACTION_TYPE, a.transaction_type) < categoryTable.rank(CATEGORY_TRANSACTION_TYPE, b.transaction_type);
 }
 
-// ============= MEMORY CALCULATION UTILITIES =============
-
-size_t calculateAlgorithmMemoryOverhead(const string& algorithm, int dataSize, bool isLinkedList) {
-    size_t overhead = 0;
-
-    if (algorithm == "Merge Sort") {
-        if (isLinkedList) {
-            overhead = dataSize * sizeof(Transaction) * 2;
-        } else {
-            overhead = dataSize * sizeof(Transaction);
-        }
-    }
-    else if (algorithm == "Quick Sort") {
-        if (isLinkedList) {
-            overhead = dataSize * sizeof(Transaction) + (dataSize * sizeof(int) * 2);
-        } else {
-            overhead = dataSize * sizeof(int) * 2;
-        }
-    }
-    else if (algorithm == "Heap Sort") {
-        if (isLinkedList) {
-            overhead = dataSize * sizeof(Transaction);
-        } else {
-            overhead = 100;
-        }
-    }
-    else if (algorithm == "Binary Search") {
-        if (isLinkedList) {
-            overhead = dataSize * sizeof(Transaction);
-        } else {
-            overhead = 50;
-        }
-    }
-    else if (algorithm == "Interpolation Search") {
-        if (isLinkedList) {
-            overhead = dataSize * sizeof(Transaction);
-        } else {
-            overhead = 100;
-        }
-    }
-    else if (algorithm == "Exponential Search") {
-        if (isLinkedList) {
-            overhead = dataSize * sizeof(Transaction);
-        } else {
-            overhead = 100;
-        }
-    }
+bool fastLocationCompare(const HotTransaction& a, const HotTransaction& b) {
+    return categoryTable.rank(CATEGORY_LOCATION, a.location) < categoryTable.rank(CATEGORY_LOCATION, b.location);
+}
 
-    return overhead;
+bool fastTypeCompare(const HotTransaction& a, const HotTransaction& b) {
+    return categoryTable.rank(CATEGORY_TRANSACTION_TYPE, a.transaction_type) < categoryTable.rank(CATEGORY_TRANSACTION_TYPE, b.transaction_type);
 }
 
 // ============= DATA STRUCTURE CONVERSION UTILITIES =============
 
-// Helper function to convert linked list to array (eliminates redundant code)
-Transaction* convertListToArray(const SinglyLinkedList& list) {
-    int size = list.getSize();
+// Hot records of the list in order; searches only need these, not full copies
+HotTransaction* convertListToArray(const SinglyLinkedList& list) {
+    size_t size = list.getSize();
     if (size == 0) return nullptr;
 
-    Transaction* tempArr = new Transaction[size];
+    HotTransaction* tempArr = new HotTransaction[size];
     ListNode* current = list.getHead();
-    for (int i = 0; i < size && current != nullptr; i++) {
-        tempArr[i] = current->data;
+    for (size_t i = 0; i < size && current != nullptr; i++) {
+        tempArr[i] = HotTransaction(current->data, (uint32_t)i);
         current = current->next;
     }
     return tempArr;
 }
 
-// Helper function to convert linked list to array and back (eliminates redundant code)
-void convertListToArrayAndSort(SinglyLinkedList& list, void (*sortFunction)(Transaction*, int)) {
-    int n = list.getSize();
+// Sorts the hot records, then relinks the existing nodes in that order,
+// so no record is copied and no node is reallocated
+void convertListToArrayAndSort(SinglyLinkedList& list, void (*sortFunction)(HotTransaction*, size_t)) {
+    size_t n = list.getSize();
     if (n <= 1) return;
 
-    Transaction* arr = new Transaction[n];
+    HotTransaction* arr = new HotTransaction[n];
+    ListNode** nodes = new ListNode*[n];
     ListNode* current = list.getHead();
-    for (int i = 0; i < n; i++) {
-        arr[i] = current->data;
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = HotTransaction(current->data, (uint32_t)i);
+        nodes[i] = current;
         current = current->next;
     }
 
     sortFunction(arr, n);
 
-    list.clear();
-    for (int i = 0; i < n; i++) list.push_back(arr[i]);
+    for (size_t i = 0; i + 1 < n; i++) {
+        nodes[arr[i].cold]->next = nodes[arr[i + 1].cold];
+    }
+    nodes[arr[n - 1].cold]->next = nullptr;
+    list.setHead(nodes[arr[0].cold]);
+
+    delete[] nodes;
+    delete[] arr;
+}
+
+// Unrolled lists are sorted in place: records move out to an array and back
+// into the same slots in hot order, so no blocks are reallocated
+void convertListToArrayAndSort(UnrolledLinkedList& list, void (*sortFunction)(HotTransaction*, size_t)) {
+    size_t n = list.getSize();
+    if (n <= 1) return;
+
+    HotTransaction* arr = new HotTransaction[n];
+    Transaction* cold = new Transaction[n];
+    size_t k = 0;
+    for (UnrolledNode* node = list.getHead(); node != nullptr; node = node->next) {
+        for (int i = 0; i < node->count; i++) {
+            arr[k] = HotTransaction(node->item(i), (uint32_t)k);
+            cold[k] = move(node->item(i));
+            k++;
+        }
+    }
+
+    sortFunction(arr, n);
+
+    k = 0;
+    for (UnrolledNode* node = list.getHead(); node != nullptr; node = node->next) {
+        for (int i = 0; i < node->count; i++) node->item(i) = move(cold[arr[k++].cold]);
+    }
+    delete[] cold;
     delete[] arr;
 }
 
+// transaction_type codes in list order; searches probe these instead of copying records
+CategoryCode* collectTransactionTypes(const UnrolledLinkedList& list) {
+    size_t n = list.getSize();
+    if (n == 0) return nullptr;
+
+    CategoryCode* types = new CategoryCode[n];
+    size_t k = 0;
+    for (UnrolledNode* node = list.getHead(); node != nullptr; node = node->next) {
+        for (int i = 0; i < node->count; i++) types[k++] = node->item(i).transaction_type;
+    }
+    return types;
+}
+
+// ============= HOT/COLD RECORD UTILITIES =============
+
+HotTransaction* buildHotRecords(const DynamicArray& arr) {
+    size_t n = arr.getSize();
+    HotTransaction* hot = new HotTransaction[n];
+    for (size_t i = 0; i < n; i++) {
+        hot[i] = HotTransaction(arr[i], (uint32_t)i);
+    }
+    return hot;
+}
+
+// Moves the full records so that arr[i] becomes the cold record of hot[i].
+// The permutation is applied in place one cycle at a time: each record moves
+// once, with a single temporary per cycle and a flag per row as extra memory.
+void applyHotOrder(DynamicArray& arr, const HotTransaction* hot) {
+    size_t n = arr.getSize();
+    bool* placed = new bool[n]();
+
+    for (size_t start = 0; start < n; start++) {
+        if (placed[start]) continue;
+        placed[start] = true;
+        if (hot[start].cold == start) continue;
+
+        Transaction temp = move(arr[start]);
+        size_t i = start;
+        while (hot[i].cold != start) {
+            size_t source = hot[i].cold;
+            arr[i] = move(arr[source]);
+            placed[source] = true;
+            i = source;
+        }
+        arr[i] = move(temp);
+    }
+    delete[] placed;
+}
+
 // ============= ARRAY SORT FUNCTIONS FOR HELPER =============
 
-void mergeSortArrayByLocation(Transaction* arr, int n) {
-    Transaction* temp = new Transaction[n];
-    for (int size = 1; size < n; size *= 2) {
-        for (int left = 0; left < n - 1; left += 2 * size) {
-            int mid = minInt(left + size - 1, n - 1);
-            int right = minInt(left + 2 * size - 1, n - 1);
+void mergeSortArrayByLocation(HotTransaction* arr, size_t n) {
+    HotTransaction* temp = new HotTransaction[n];
+    for (size_t size = 1; size < n; size *= 2) {
+        for (size_t left = 0; left < n - 1; left += 2 * size) {
+            size_t mid = minSize(left + size - 1, n - 1);
+            size_t right = minSize(left + 2 * size - 1, n - 1);
 
             if (mid < right) {
-                int i = left, j = mid + 1, k = left;
+                size_t i = left, j = mid + 1, k = left;
 
-                for (int x = left; x <= mid; x++) temp[x] = arr[x];
+                for (size_t x = left; x <= mid; x++) temp[x] = arr[x];
 
                 while (i <= mid && j <= right) {
-                    if (fastLocationCompare(temp[i], arr[j])) {
+                    if (!fastLocationCompare(arr[j], temp[i])) {
                         arr[k++] = temp[i++];
                     } else {
                         arr[k++] = arr[j++];
@@ -238,20 +282,20 @@ void mergeSortArrayByLocation(Transaction* arr, int n) {
     delete[] temp;
 }
 
-void mergeSortArrayByType(Transaction* arr, int n) {
-    Transaction* temp = new Transaction[n];
-    for (int size = 1; size < n; size *= 2) {
-        for (int left = 0; left < n - 1; left += 2 * size) {
-            int mid = minInt(left + size - 1, n - 1);
-            int right = minInt(left + 2 * size - 1, n - 1);
+void mergeSortArrayByType(HotTransaction* arr, size_t n) {
+    HotTransaction* temp = new HotTransaction[n];
+    for (size_t size = 1; size < n; size *= 2) {
+        for (size_t left = 0; left < n - 1; left += 2 * size) {
+            size_t mid = minSize(left + size - 1, n - 1);
+            size_t right = minSize(left + 2 * size - 1, n - 1);
 
             if (mid < right) {
-                int i = left, j = mid + 1, k = left;
+                size_t i = left, j = mid + 1, k = left;
 
-                for (int x = left; x <= mid; x++) temp[x] = arr[x];
+                for (size_t x = left; x <= mid; x++) temp[x] = arr[x];
 
                 while (i <= mid && j <= right) {
-                    if (fastTypeCompare(temp[i], arr[j])) {
+                    if (!fastTypeCompare(arr[j], temp[i])) {
                         arr[k++] = temp[i++];
                     } else {
                         arr[k++] = arr[j++];
@@ -264,58 +308,20 @@ void mergeSortArrayByType(Transaction* arr, int n) {
     delete[] temp;
 }
 
-void quickSortArray(Transaction* arr, int n) {
-    if (n <= 1) return;
-
-    int* stack = new int[n * 2];
-    int top = -1;
-
-    stack[++top] = 0;
-    stack[++top] = n - 1;
-
-    while (top >= 0) {
-        int high = stack[top--];
-        int low = stack[top--];
-
-        if (low < high) {
-            // Partition
-            Transaction pivot = arr[high];
-            int i = low - 1;
-
-            for (int j = low; j < high; j++) {
-                if (fastLocationCompare(arr[j], pivot)) {
-                    i++;
-                    swapTransactions(arr[i], arr[j]);
-                }
-            }
-            swapTransactions(arr[i + 1], arr[high]);
-            int pi = i + 1;
-
-            // Push left and right subarrays
-            if (pi - 1 > low) {
-                stack[++top] = low;
-                stack[++top] = pi - 1;
-            }
-            if (pi + 1 < high) {
-                stack[++top] = pi + 1;
-                stack[++top] = high;
-            }
-        }
-    }
-
-    delete[] stack;
+void quickSortArray(HotTransaction* arr, size_t n) {
+    introSort(arr, n, [](const HotTransaction& a, const HotTransaction& b) { return fastLocationCompare(a, b); });
 }
 
-void heapSortArray(Transaction* arr, int n) {
+void heapSortArray(HotTransaction* arr, size_t n) {
     if (n <= 1) return;
 
     // Build heap
-    for (int i = n / 2 - 1; i >= 0; i--) {
-        int parent = i;
+    for (size_t i = n / 2; i-- > 0;) {
+        size_t parent = i;
         while (true) {
-            int largest = parent;
-            int left = 2 * parent + 1;
-            int right = 2 * parent + 2;
+            size_t largest = parent;
+            size_t left = 2 * parent + 1;
+            size_t right = 2 * parent + 2;
 
             if (left < n && !fastLocationCompare(arr[left], arr[largest])) largest = left;
             if (right < n && !fastLocationCompare(arr[right], arr[largest])) largest = right;
@@ -328,14 +334,14 @@ void heapSortArray(Transaction* arr, int n) {
     }
 
     // Extract elements
-    for (int i = n - 1; i > 0; i--) {
+    for (size_t i = n - 1; i > 0; i--) {
         swapTransactions(arr[0], arr[i]);
 
-        int parent = 0;
+        size_t parent = 0;
         while (true) {
-            int largest = parent;
-            int left = 2 * parent + 1;
-            int right = 2 * parent + 2;
+            size_t largest = parent;
+            size_t left = 2 * parent + 1;
+            size_t right = 2 * parent + 2;
 
             if (left < i && !fastLocationCompare(arr[left], arr[largest])) largest = left;
             if (right < i && !fastLocationCompare(arr[right], arr[largest])) largest = right;
@@ -348,6 +354,22 @@ void heapSortArray(Transaction* arr, int n) {
     }
 }
 
+// Location and type are coded, so their ranks are small integers to count
+void countingSortArray(HotTransaction* arr, size_t n) {
+    countingSortBy(arr, n, (size_t)categoryTable.size(CATEGORY_LOCATION),
+                   [](const HotTransaction& h) { return (size_t)categoryTable.rank(CATEGORY_LOCATION, h.location); });
+}
+
+void countingSortArrayByType(HotTransaction* arr, size_t n) {
+    countingSortBy(arr, n, (size_t)categoryTable.size(CATEGORY_TRANSACTION_TYPE),
+                   [](const HotTransaction& h) { return (size_t)categoryTable.rank(CATEGORY_TRANSACTION_TYPE, h.transaction_type); });
+}
+
+// Works on the location text itself, as it would for a column with no ranks
+void radixSortArray(HotTransaction* arr, size_t n) {
+    msdRadixSort(arr, n, [](const HotTransaction& h) -> const string& { return categoryName(CATEGORY_LOCATION, h.location); });
+}
+
 // ============= JSON FORMATTING UTILITIES =============
 
 void writeJsonString(ofstream& file, const string& str) {
@@ -366,115 +388,129 @@ void writeJsonString(ofstream& file, const string& str) {
 
 void writeJsonTransaction(ofstream& file, const Transaction& trans, bool isLast) {
     file << "    {\n";
-    file << "      \"transaction_id\": "; writeJsonString(file, trans.transaction_id); file << ",\n";
+    file << "      \"transaction_id\": "; writeJsonString(file, formatPrefixedKey(trans.transaction_id, TRANSACTION_ID_PREFIX)); file << ",\n";
     file << "      \"timestamp\": "; writeJsonString(file, trans.timestamp); file << ",\n";
-    file << "      \"sender_account\": "; writeJsonString(file, trans.sender_account); file << ",\n";
-    file << "      \"receiver_account\": "; writeJsonString(file, trans.receiver_account); file << ",\n";
+    file << "      \"sender_account\": "; writeJsonString(file, formatPrefixedKey(trans.sender_account, ACCOUNT_PREFIX)); file << ",\n";
+    file << "      \"receiver_account\": "; writeJsonString(file, formatPrefixedKey(trans.receiver_account, ACCOUNT_PREFIX)); file << ",\n";
     file << "      \"amount\": " << fixed << setprecision(2) << trans.amount << ",\n";
-    file << "      \"transaction_type\": "; writeJsonString(file, trans.transaction_type); file << ",\n";
-    file << "      \"merchant_category\": "; writeJsonString(file, trans.merchant_category); file << ",\n";
-    file << "      \"location\": "; writeJsonString(file, trans.location); file << ",\n";
-    file << "      \"device_used\": "; writeJsonString(file, trans.device_used); file << ",\n";
+    file << "      \"transaction_type\": "; writeJsonString(file, categoryName(CATEGORY_TRANSACTION_TYPE, trans.transaction_type)); file << ",\n";
+    file << "      \"merchant_category\": "; writeJsonString(file, categoryName(CATEGORY_MERCHANT, trans.merchant_category)); file << ",\n";
+    file << "      \"location\": "; writeJsonString(file, categoryName(CATEGORY_LOCATION, trans.location)); file << ",\n";
+    file << "      \"device_used\": "; writeJsonString(file, categoryName(CATEGORY_DEVICE, trans.device_used)); file << ",\n";
     file << "      \"is_fraud\": " << (trans.is_fraud ? "true" : "false") << ",\n";
-    file << "      \"fraud_type\": "; writeJsonString(file, trans.fraud_type); file << ",\n";
+    file << "      \"fraud_type\": "; writeJsonString(file, categoryName(CATEGORY_FRAUD_TYPE, trans.fraud_type)); file << ",\n";
     file << "      \"time_since_last_transaction\": " << trans.time_since_last_transaction << ",\n";
     file << "      \"spending_deviation_score\": " << trans.spending_deviation_score << ",\n";
     file << "      \"velocity_score\": " << trans.velocity_score << ",\n";
     file << "      \"geo_anomaly_score\": " << trans.geo_anomaly_score << ",\n";
-    file << "      \"payment_channel\": "; writeJsonString(file, trans.payment_channel); file << ",\n";
-    file << "      \"ip_address\": "; writeJsonString(file, trans.ip_address); file << ",\n";
-    file << "      \"device_hash\": "; writeJsonString(file, trans.device_hash); file << "\n";
+    file << "      \"payment_channel\": "; writeJsonString(file, categoryName(CATEGORY_PAYMENT_CHANNEL, trans.payment_channel)); file << ",\n";
+    file << "      \"ip_address\": "; writeJsonString(file, formatIpAddress(trans.ip_address)); file << ",\n";
+    file << "      \"device_hash\": "; writeJsonString(file, formatDeviceHash(trans.device_hash)); file << "\n";
     file << "    }" << (isLast ? "\n" : ",\n");
 }
 
-// ============= DATA PROCESSING WITH ERROR HANDLING =============
+void writeJsonTransaction(ofstream& file, const TransactionRow& row, bool isLast) {
+    file << "    {\n";
+    file << "      \"transaction_id\": "; writeJsonString(file, formatPrefixedKey(row.transaction_id(), TRANSACTION_ID_PREFIX)); file << ",\n";
+    file << "      \"timestamp\": "; writeJsonString(file, row.timestamp()); file << ",\n";
+    file << "      \"sender_account\": "; writeJsonString(file, formatPrefixedKey(row.sender_account(), ACCOUNT_PREFIX)); file << ",\n";
+    file << "      \"receiver_account\": "; writeJsonString(file, formatPrefixedKey(row.receiver_account(), ACCOUNT_PREFIX)); file << ",\n";
+    file << "      \"amount\": " << fixed << setprecision(2) << row.amount() << ",\n";
+    file << "      \"transaction_type\": "; writeJsonString(file, categoryName(CATEGORY_TRANSACTION_TYPE, row.transaction_type())); file << ",\n";
+    file << "      \"merchant_category\": "; writeJsonString(file, categoryName(CATEGORY_MERCHANT, row.merchant_category())); file << ",\n";
+    file << "      \"location\": "; writeJsonString(file, categoryName(CATEGORY_LOCATION, row.location())); file << ",\n";
+    file << "      \"device_used\": "; writeJsonString(file, categoryName(CATEGORY_DEVICE, row.device_used())); file << ",\n";
+    file << "      \"is_fraud\": " << (row.is_fraud() ? "true" : "false") << ",\n";
+    file << "      \"fraud_type\": "; writeJsonString(file, categoryName(CATEGORY_FRAUD_TYPE, row.fraud_type())); file << ",\n";
+    file << "      \"time_since_last_transaction\": " << row.time_since_last_transaction() << ",\n";
+    file << "      \"spending_deviation_score\": " << row.spending_deviation_score() << ",\n";
+    file << "      \"velocity_score\": " << row.velocity_score() << ",\n";
+    file << "      \"geo_anomaly_score\": " << row.geo_anomaly_score() << ",\n";
+    file << "      \"payment_channel\": "; writeJsonString(file, categoryName(CATEGORY_PAYMENT_CHANNEL, row.payment_channel())); file << ",\n";
+    file << "      \"ip_address\": "; writeJsonString(file, formatIpAddress(row.ip_address())); file << ",\n";
+    file << "      \"device_hash\": "; writeJsonString(file, formatDeviceHash(row.device_hash())); file << "\n";
+    file << "    }" << (isLast ? "\n" : ",\n");
+}
 
-bool imputeCSVData(const string& inputFile, const string& outputFile) {
-    cout << "\nProcessing missing values..." << endl;
+// ============= DATA PROCESSING WITH ERROR HANDLING =============
 
-    ifstream inFile(inputFile);
-    if (!inFile.is_open()) {
-        cout << "Error: Cannot open input file." << endl;
-        return false;
+// Values treated as missing by the imputation step
+static bool isMissingValue(string_view field) {
+    bool onlyWhitespace = true;
+    for (size_t j = 0; j < field.length(); j++) {
+        if (field[j] != ' ' && field[j] != '\t' && field[j] != '\r' && field[j] != '\n') {
+            onlyWhitespace = false;
+            break;
+        }
     }
+    return onlyWhitespace || field == "NULL" || field == "null" || field == "NA" || field == "n/a";
+}
 
-    ofstream outFile(outputFile);
-    if (!outFile.is_open()) {
-        cout << "Error: Cannot create output file." << endl;
-        inFile.close();
-        return false;
-    }
+static void appendImputedField(string& processedLine, string_view field, int fieldCount, int& imputedFields) {
+    if (fieldCount > 0) processedLine += ',';
 
-    string line;
-    int totalRows = 0;
-    int imputedFields = 0;
+    if (isMissingValue(field)) {
+        processedLine += "Null";
+        imputedFields++;
+    } else {
+        processedLine.append(field.data(), field.size());
+    }
+}
 
-    // Copy header first
-    if (getline(inFile, line)) {
-        outFile << line << endl;
+// Quote-aware character loop, only needed for lines that contain '"'
+static void imputeQuotedLine(string_view line, string& processedLine, int& imputedFields) {
+    bool inQuotes = false;
+    size_t fieldStart = 0;
+    int fieldCount = 0;
+
+    for (size_t i = 0; i <= line.length(); i++) {
+        char c = (i < line.length()) ? line[i] : ','; // Treat end of line as comma
+
+        if (c == '"' && i < line.length()) {
+            inQuotes = !inQuotes;
+        } else if (c == ',' && !inQuotes) {
+            appendImputedField(processedLine, line.substr(fieldStart, i - fieldStart), fieldCount, imputedFields);
+            fieldStart = i + 1;
+            fieldCount++;
+        }
     }
+}
 
-    while (getline(inFile, line)) {
-        if (line.empty()) continue;
-
-        // Manual CSV parsing to handle empty fields properly
-        string processedLine = "";
-        bool inQuotes = false;
-        string currentField = "";
-        int fieldCount = 0;
-
-        for (size_t i = 0; i <= line.length(); i++) {
-            char c = (i < line.length()) ? line[i] : ','; // Treat end of line as comma
-
-            if (c == '"' && i < line.length()) {
-                inQuotes = !inQuotes;
-                currentField += c;
-            } else if (c == ',' && !inQuotes) {
-                // Process the current field
-                if (fieldCount > 0) processedLine += ",";
-
-                // Check if field is empty or contains only whitespace
-                bool isEmpty = currentField.empty();
-                if (!isEmpty) {
-                    // Check if field contains only whitespace
-                    bool onlyWhitespace = true;
-                    for (size_t j = 0; j < currentField.length(); j++) {
-                        if (currentField[j] != ' ' && currentField[j] != '\t' && currentField[j] != '\r' && currentField[j] != '\n') {
-                            onlyWhitespace = false;
-                            break;
-                        }
-                    }
-                    isEmpty = onlyWhitespace;
-                }
+// Splits one line with the SIMD delimiter kernel and replaces missing fields with "Null"
+void imputeCSVLine(string_view line, string& processedLine, int& imputedFields) {
+    processedLine.clear();
 
-                if (isEmpty || currentField == "NULL" || currentField == "null" || currentField == "NA" || currentField == "n/a") {
-                    processedLine += "Null";
-                    imputedFields++;
-                } else {
-                    processedLine += currentField;
-                }
+    const char* data = line.data();
+    size_t fieldStart = 0;
+    int fieldCount = 0;
+    int lineImputed = 0; // Only added once the line is known to be quote-free
 
-                currentField = "";
-                fieldCount++;
-            } else if (i < line.length()) {
-                currentField += c;
-            }
+    for (size_t blockStart = 0; blockStart < line.size(); blockStart += DELIMITER_BLOCK_SIZE) {
+        size_t blockLength = line.size() - blockStart;
+        if (blockLength > (size_t)DELIMITER_BLOCK_SIZE) blockLength = DELIMITER_BLOCK_SIZE;
+
+        DelimiterMasks masks = scanDelimiters(data + blockStart, blockLength);
+        if (masks.quotes != 0) {
+            processedLine.clear();
+            imputeQuotedLine(line, processedLine, imputedFields);
+            return;
         }
 
-        outFile << processedLine << endl;
-        totalRows++;
+        uint32_t commas = masks.commas;
+        while (commas != 0) {
+            size_t comma = blockStart + countTrailingZeros(commas);
+            appendImputedField(processedLine, line.substr(fieldStart, comma - fieldStart), fieldCount, lineImputed);
+            fieldStart = comma + 1;
+            fieldCount++;
+            commas &= commas - 1;
+        }
     }
 
-    inFile.close();
-    outFile.close();
-
-    cout << "Processing completed: " << totalRows << " rows, " << imputedFields << " fields imputed" << endl;
-    cout << "Dataset ready for analysis." << endl;
-
-    return true;
+    appendImputedField(processedLine, line.substr(fieldStart), fieldCount, lineImputed);
+    imputedFields += lineImputed;
 }
 
-bool processAndImputeData() {
+bool processAndImputeData(ChannelArray& channelArrays) {
     cout << "\n=== LOAD AND PROCESS FINANCIAL DATA ===" << endl;
     cout << "Enter CSV file path: ";
 
@@ -485,23 +521,31 @@ bool processAndImputeData() {
         return false;
     }
 
-    try {
-        cout << "Reducing to 100,000 rows..." << endl;
+    cout << "Sampling method (1=Evenly spaced, 2=Random, 3=Full dataset, no reduction): ";
+    int samplingChoice = getSafeIntegerInput(1, 3);
+    SamplingMode samplingMode = SAMPLE_STRIDE;
+    if (samplingChoice == 2) samplingMode = SAMPLE_RESERVOIR;
+    if (samplingChoice == 3) samplingMode = SAMPLE_ALL;
 
-        string reducedPath = "reduced_dataset.csv";
-        if (!reduceCSV(originalPath, reducedPath, 100000)) {
-            cout << "Error: Failed to reduce dataset." << endl;
-            return false;
+    try {
+        if (samplingMode == SAMPLE_ALL) {
+            cout << "Keeping every row..." << endl;
+        } else {
+            cout << "Reducing to 100,000 rows..." << endl;
         }
 
-        analyzeData(reducedPath);
+        // Options 2 and 5 reload imputed_dataset.csv, so that one is still written
+        PipelineOptions options;
+        options.writeImputedCSV = true;
 
-        string imputedPath = "imputed_dataset.csv";
-        if (!imputeCSVData(reducedPath, imputedPath)) {
+        if (!runFusedPipeline(originalPath, 100000, samplingMode, options, channelArrays)) {
             cout << "Error: Failed to process data." << endl;
             return false;
         }
 
+        // Lets Option 2 (and the next run) skip re-parsing the imputed CSV
+        writeSnapshot(snapshotPathFor(options.imputedPath), channelArrays, options.imputedPath);
+
         cout << "Data processing completed successfully." << endl;
         return true;
 